@@ -0,0 +1,45 @@
+#pragma once
+
+#include "globals.h"
+#include <string_view>
+
+// Registry of every encrypted pattern blob embedded in the DLL.
+//
+// The original decrypts each blob on demand (inline in sub_1800282B0 and
+// sub_180001020), copying it to the stack first. Here all blobs are
+// decrypted once at startup into a single page-aligned arena which is then
+// made read-only; consumers get string_views into it.
+
+namespace EncryptedBlobs {
+    enum class BlobId : int {
+        HookPatchTarget,     // 64 bytes - byte patch at +23 (5914491 - 14786821)
+        HookPatchSecondary,  // 45 bytes - byte patch at +6 (5914491 - 14786821)
+        AdditionalHookFunc,  // 95 bytes - qword_18004FDB8
+        AdditionalAddr,      // 84 bytes - qword_18004FDD0
+        InputKey1,           // 87 bytes - InputKey, config 1
+        InputKey2,           // 75 bytes - InputKey, configs 2-6
+        InputKey3,           // 82 bytes - InputKey, config 7
+        InputKey4,           // 78 bytes - InputKey, configs 8-9
+        Count
+    };
+
+    struct BlobInfo {
+        BlobId id;
+        const unsigned char* data;  // encrypted bytes
+        int length;
+        const char* purpose;
+    };
+
+    // Registry entry for a blob (encrypted form, for verification/tools)
+    const BlobInfo& GetInfo(BlobId id);
+
+    // Decrypt every registered blob into the arena in one pass and mark the
+    // arena read-only. Safe to call more than once; later calls are no-ops.
+    // Returns false (after reporting it with MessageBoxA) if the arena could
+    // not be allocated or made read-only; no blob is available then.
+    bool DecryptAll();
+
+    // Decrypted pattern text for a blob (without the null terminator).
+    // Empty until DecryptAll has run.
+    std::string_view Get(BlobId id);
+}
@@ -9,9 +9,10 @@ namespace GameLogic {
     //
     // Flow:
     //   1. Version 3700114 (v1.7.2): patch specific function to RET
-    //   2. Versions 5914491-14801545: decrypt+scan patterns, patch bytes
+    //   2. Versions 5914491-14786821: decrypt+scan patterns, patch bytes
     //   3. All versions: decrypt+scan 95-byte + 84-byte patterns
     //      to resolve AdditionalHookFunc and AdditionalAddr
+    //      (steps 1-3 are performed by Hooks::ApplyHooks)
     //   4. Call InitializeSDK (sub_180007CB0)
     //   5. Call InitConsoleAndViewport (sub_18000E8A0)
     //   6. Enter main game loop (sub_180025720, never returns)
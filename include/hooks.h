@@ -1,6 +1,7 @@
 #pragma once
 
 #include "globals.h"
+#include "signature_db.h"
 
 namespace Hooks {
     // Decrypt an encrypted pattern string using the XOR cipher
@@ -9,10 +10,25 @@ namespace Hooks {
     // Original: inline code in sub_1800282B0 and sub_180001020
     void DecryptPattern(char* buffer, int length);
 
+    // Individual decryption tiers used by DecryptPattern.
+    // Both produce identical output for any buffer and length.
+    void DecryptPatternScalar(char* buffer, int length);
+    void DecryptPatternSSE41(char* buffer, int length);
+
+    // Start scanning for AdditionalHookFunc and AdditionalAddr in the
+    // background. Called from StartAddress before it waits for GWorld.
+    void PrefetchHookTargets(int engineVersion);
+
     // Apply version-specific patches/hooks
     // Called from MainGameSetup (sub_1800282B0)
     void ApplyHooks(int engineVersion);
 
     // Patch a single byte in memory using VirtualProtect
     bool PatchByte(void* address, uint8_t value);
+
+    // The built-in byte patches, in the form SignatureDB::GetPatch reports
+    // database patches (patternIndex is 0). Used whether or not a database
+    // is loaded; false past the last one.
+    bool GetBuiltinPatch(int index, SignatureDB::PatchRecord& patch,
+                         SignatureDB::PatternRef& pattern);
 }
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "globals.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace PatternScan {
+    // Handle to an address that is resolved by pattern scan on first use.
+    //
+    // The first Get() runs the resolver (or waits for a Prefetch thread that
+    // is already running it); every later Get() is a single acquire load.
+    // A failed resolution is cached as 0 and never retried.
+    class LazyPattern {
+    public:
+        using Resolver = std::function<__int64()>;
+
+        // Attach the resolver. `publish`, if set, receives the resolved
+        // value (one interlocked store) before it becomes visible through
+        // Get(); used to fill the legacy Globals slots. Must be called
+        // before the first Get().
+        void Bind(const char* name, Resolver resolver, __int64* publish = nullptr);
+
+        bool IsBound() const { return m_resolver != nullptr; }
+        bool IsResolved() const { return m_resolved.load(std::memory_order_acquire); }
+        const char* Name() const { return m_name; }
+
+        __int64 Get()
+        {
+            if (m_resolved.load(std::memory_order_acquire))
+                return m_value;
+            return ResolveSlow();
+        }
+
+        // Resolve the given handles on the startup thread pool, one task
+        // each. Handles already resolved (or resolved concurrently by Get)
+        // are skipped; a Get() on a handle being scanned joins that scan.
+        static void Prefetch(LazyPattern* const* handles, size_t count);
+
+    private:
+        __int64 ResolveSlow();
+
+        const char* m_name = nullptr;
+        Resolver m_resolver;
+        __int64* m_publish = nullptr;
+        __int64 m_value = 0;
+        std::atomic<bool> m_resolved{false};
+        std::once_flag m_once;
+    };
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "globals.h"
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Cache of FName -> narrow name, shared by every GObjects sweep.
+//
+// Keyed by the raw 8-byte FName value (ComparisonIndex + Number), which the
+// engine never reassigns, so entries never go stale. The table is split into
+// shards with their own reader/writer lock; lookups that hit only take a
+// shared lock. When a shard exceeds its share of the byte capacity, entries
+// are evicted with the CLOCK (second-chance) policy.
+namespace NameCache {
+    static constexpr size_t kDefaultCapacity = 32 * 1024 * 1024;
+
+    // Produces the name for an FName on a miss (engine call + narrowing)
+    using Resolver = std::string (*)(uint64_t fname);
+
+    // Handle to the interned string of an entry. The string never moves;
+    // a handle keeps it alive after the entry is evicted, and copying one
+    // does not copy the characters.
+    using Name = std::shared_ptr<const std::string>;
+
+    // Cached name for `fname`, calling `resolve` on a miss (never null).
+    // A hit takes no allocation and copies no characters.
+    Name Lookup(uint64_t fname, Resolver resolve);
+
+    // Compare the cached name for `fname` with `name` in place (no copy
+    // of the cached string); Missing if `fname` is not cached, which
+    // counts as a miss
+    enum class Match : unsigned char { Equal, Different, Missing };
+    Match Compare(uint64_t fname, std::string_view name);
+
+    // Cache a name the caller resolved itself; an existing entry is kept
+    void Insert(uint64_t fname, std::string name);
+
+    // Approximate byte budget across all shards; shrinking takes effect on
+    // the next insert into each shard
+    void SetCapacity(size_t bytes);
+
+    // Drop every entry (counters are kept)
+    void Clear();
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        uint64_t entries;
+        uint64_t bytes;
+    };
+    Stats GetStats();
+
+    // Report GetStats() as nameCache.* telemetry counters
+    void PublishCounters();
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "globals.h"
+#include <string_view>
+
+// Hash index over GObjects, built in a single sweep and kept current
+// incrementally.
+//
+// Maps each object name to the first object carrying it (the object a
+// linear StaticFindObject sweep would return), and (outer name, name) to
+// the object for names that occur under several outers (properties,
+// default subobjects). Lookups verify that the slot still holds an object
+// with the indexed FName.
+//
+// The index remembers how many slots it covers (the GObjects count at the
+// last build or refresh) and the object and serial number seen in each.
+// Refresh() indexes only the slots past that watermark and re-checks a
+// bounded window of older slots for reuse, so it can run every tick.
+// MainGameLoop runs one with the default budget each pass; a lookup miss
+// runs one without the re-check to pick up objects created since.
+namespace ObjectIndex {
+    // Older slots re-checked for reuse per Refresh() by default
+    constexpr size_t kDefaultRecheckBudget = 4096;
+
+    // Sweep GObjects and (re)build the index. Returns false if GObjects is
+    // not resolved yet. Safe to call from any thread.
+    bool Build();
+
+    // Index slots added since the last build or refresh, and re-check up
+    // to `recheckBudget` older slots (round robin) whose object or serial
+    // number changed; the keys of emptied or replaced slots are removed,
+    // so the index does not grow with objects that are gone. Builds if
+    // nothing is indexed yet. Returns the number of slots (re)indexed.
+    // Safe to call from any thread.
+    size_t Refresh(size_t recheckBudget = kDefaultRecheckBudget);
+
+    // Drop the index and its slot records (GObjects was replaced); the
+    // next lookup builds it again
+    void Reset();
+
+    // Whether a build has completed
+    bool IsBuilt();
+
+    // First object named `name`, or 0 if not indexed (builds on first use)
+    __int64 Find(std::string_view name);
+
+    // Object named `name` whose Outer is named `outerName`, or 0
+    __int64 FindInOuter(std::string_view outerName, std::string_view name);
+
+    struct Stats {
+        uint64_t objects;        // non-null slots visited
+        uint64_t names;          // distinct names
+        uint64_t outerKeys;      // distinct (outer, name) pairs
+        uint64_t buildTimeNs;    // duration of the last build
+        uint64_t bytes;          // approximate heap use of the index
+        uint64_t watermark;      // GObjects slots covered
+        uint64_t refreshes;      // Refresh() calls since the build
+        uint64_t reindexed;      // slots indexed by those refreshes
+        uint64_t removed;        // emptied or replaced slots forgotten by them
+        uint64_t refreshTimeNs;  // duration of the last refresh
+    };
+    Stats GetStats();
+
+    // Report GetStats() as objectIndex.* telemetry counters
+    void PublishCounters();
+}
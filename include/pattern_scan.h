@@ -3,8 +3,35 @@
 #include "globals.h"
 #include <vector>
 #include <string>
+#include <string_view>
 
 namespace PatternScan {
+    // Byte/mask form of an IDA-style pattern, ready for scanning.
+    // Fixed capacity so compiling a pattern never touches the heap.
+    // mask[i] is 0xFF for a literal byte and 0x00 for a wildcard.
+    struct CompiledPattern {
+        static constexpr int kMaxSize = 128;
+        unsigned char bytes[kMaxSize];
+        unsigned char mask[kMaxSize];
+        int size;
+    };
+
+    // Non-owning view of a compiled pattern. Lets the scanner run directly
+    // on patterns stored elsewhere (e.g. the mapped signature database).
+    struct PatternView {
+        const unsigned char* bytes;
+        const unsigned char* mask;
+        int size;
+    };
+
+    // Most alternative signatures a single symbol may carry
+    static constexpr int kMaxAlternatives = 4;
+
+    inline PatternView ViewOf(const CompiledPattern& pattern)
+    {
+        return PatternView{pattern.bytes, pattern.mask, pattern.size};
+    }
+
     // Parse a pattern string ("48 8B ? ? 01") into an int vector
     // -1 entries are wildcards (? or ??)
     // Original: sub_180026F70
@@ -16,6 +43,54 @@ namespace PatternScan {
     uintptr_t FindPattern(HMODULE module, const char* patternStr,
                           int offset_a = 0, int offset_b = 0);
 
+    // Compile a pattern string into byte/mask form without allocating.
+    // Same token rules as ParsePattern. Accepts views into the decrypted
+    // blob arena (EncryptedBlobs::Get) directly. Returns false if the
+    // pattern is empty or exceeds CompiledPattern::kMaxSize tokens.
+    bool CompilePattern(std::string_view pattern, CompiledPattern& out);
+
+    // Find a compiled pattern in module memory
+    // Returns the matching address, or 0 on failure
+    uintptr_t FindPatternCompiled(HMODULE module, const PatternView& pattern);
+
+    // Scanner implementation that produced a result
+    enum class ScanTier : unsigned char {
+        Scalar,     // byte-wise XOR/AND compare
+    };
+
+    // Cost and outcome of one scan, for telemetry
+    struct ScanStats {
+        ScanTier tier;
+        bool exhaustive;            // scan did not stop at the first match
+        uint64_t bytesScanned;      // image offsets visited
+        uint64_t candidatesTested;  // offsets whose first literal pattern byte matched
+        uint32_t matchCount;        // matches seen (0/1 unless exhaustive)
+        uint64_t wallTimeNs;
+        int alternative;            // index of the signature that won, -1 if none
+    };
+
+    // Same as FindPatternCompiled, filling `stats`. With `exhaustive` the
+    // scan continues past the first match to count every match in the
+    // image (still returning the first), which exposes ambiguous patterns.
+    uintptr_t FindPatternCompiled(HMODULE module, const PatternView& pattern,
+                                  ScanStats& stats, bool exhaustive = false);
+
+    // Scan for up to kMaxAlternatives signatures of one symbol in a single
+    // sweep of the image. Index 0 has the highest priority. Returns the index
+    // of the highest-priority signature that matched anywhere (its first
+    // match in `address`), or -1. Lower-priority signatures stop being tested
+    // once a higher one has matched, and the sweep ends as soon as nothing
+    // can beat the current winner. Stats cover the whole sweep; matchCount
+    // is for the winning signature.
+    int FindFirstOfCompiled(HMODULE module, const PatternView* patterns, int count,
+                            uintptr_t& address, ScanStats& stats,
+                            bool exhaustive = false);
+
+    inline uintptr_t FindPatternCompiled(HMODULE module, const CompiledPattern& pattern)
+    {
+        return FindPatternCompiled(module, ViewOf(pattern));
+    }
+
     // Find pattern from pre-parsed int vector
     // Returns offset from module base, or 0 on failure
     uintptr_t FindPatternRaw(HMODULE module, const std::vector<int>& pattern);
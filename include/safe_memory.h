@@ -0,0 +1,36 @@
+#pragma once
+
+#include "globals.h"
+
+// Fault-safe reads of game memory, in place of IsBadReadPtr.
+//
+// IsBadReadPtr probes the range under structured exception handling on
+// every call and can strip guard pages of other threads. Here the readable
+// committed regions of the process are kept in a snapshot taken with
+// VirtualQuery, so a check is a binary search under a shared lock. An
+// address outside the snapshot refreshes it (at most every kMinRefreshMs)
+// and is checked again; until a refresh is due it is reported unreadable.
+// Read() additionally copies under SEH, which catches memory released
+// since the snapshot was taken.
+namespace SafeMemory {
+    // Minimum time between snapshot refreshes triggered by misses
+    static constexpr unsigned kMinRefreshMs = 500;
+
+    // Whether [address, address + size) is committed readable memory. Fails
+    // closed: memory committed since the last refresh may read as false
+    // for up to kMinRefreshMs.
+    bool IsReadable(const void* address, size_t size);
+
+    // Copy `size` bytes from `address` into `out`; false (and `out` left
+    // unspecified) if any of them could not be read
+    bool Read(const void* address, void* out, size_t size);
+
+    template <typename T>
+    bool Read(__int64 address, T& out)
+    {
+        return Read(reinterpret_cast<const void*>(address), &out, sizeof(T));
+    }
+
+    // Retake the snapshot now
+    void Refresh();
+}
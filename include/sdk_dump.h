@@ -0,0 +1,42 @@
+#pragma once
+
+#include "globals.h"
+#include <string>
+
+// Reflection dump of everything GObjects describes, for mapping offsets of
+// a new season without doing it by hand.
+//
+// Collects every UClass, UScriptStruct, UEnum and UFunction (blueprint
+// and delegate variants included), reads their supers, sizes, properties,
+// parameters and enum values, and writes:
+//   <directory>\<Package>.hpp   padded structs with offsets and sizes,
+//                               enums and function parameter structs
+//   <directory>\reflection.json the same data as one JSON document
+// Collection, reading and formatting are split into blocks run on the
+// calling thread plus the ThreadPool workers; output goes out through
+// large buffered writes.
+namespace SdkDump {
+    // Write the dump into `directory` (which must exist). Returns false if
+    // GObjects is not resolved or a file could not be written (reported
+    // with MessageBoxA).
+    bool Dump(const std::string& directory);
+
+    // <config path>\rift_sdk; a dump is wanted when this directory exists
+    std::string DefaultDirectory();
+    bool Requested();
+
+    struct Stats {
+        uint64_t classes;      // UClass and blueprint classes
+        uint64_t structs;      // UScriptStruct
+        uint64_t enums;
+        uint64_t functions;
+        uint64_t properties;   // across all of the above
+        uint64_t packages;     // headers written
+        uint64_t bytes;        // headers plus JSON
+        uint64_t timeNs;       // duration of the last dump
+    };
+    Stats GetStats();
+
+    // Report GetStats() as sdkDump.* telemetry counters
+    void PublishCounters();
+}
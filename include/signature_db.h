@@ -0,0 +1,130 @@
+#pragma once
+
+#include "globals.h"
+#include "pattern_scan.h"
+#include "version_config.h"
+#include <string>
+#include <string_view>
+
+// External signature database.
+//
+// The version table, pattern sets and hook patches can be shipped next to
+// the DLL instead of being compiled in. The source is a JSON file
+// (data/signatures.json); tools/sigdbc compiles it offline into a compact
+// binary image (signatures.rsdb) with sorted CL ranges and pre-compiled
+// byte/mask patterns. The DLL maps that image read-only and reads records
+// in place, so startup cost does not grow with the number of versions.
+//
+// When no image is present the built-in tables in version_config.cpp and
+// hooks.cpp are used unchanged.
+//
+// Image layout (little-endian, all offsets from the start of the image):
+//   Header
+//   VersionInterval[intervalCount]    sorted, disjoint (checked by sigdbc)
+//   PatternSetRecord[setCount]         consecutive records with the same
+//                                     name are alternative signatures
+//   PatternRecord[patternCount]
+//   PatchRecord[patchCount]
+//   char strings[stringsSize]         null-terminated pattern names
+//   uint8 bytes[bytesSize]            per pattern: bytes[size] then mask[size]
+//
+// Patterns the DLL embeds encrypted (EncryptedBlobs) are not written out:
+// the source names the blob and the record refers to it by BlobId, so the
+// pattern text exists only in the decrypted arena at run time.
+
+namespace SignatureDB {
+    static constexpr uint32_t kMagic = 0x42445352;   // "RSDB"
+    static constexpr uint32_t kFormatVersion = 2;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t formatVersion;
+        uint32_t imageSize;
+        uint32_t intervalCount;
+        uint32_t intervalOffset;
+        uint32_t setCount;
+        uint32_t setOffset;
+        uint32_t patternCount;
+        uint32_t patternOffset;
+        uint32_t patchCount;
+        uint32_t patchOffset;
+        uint32_t stringsSize;
+        uint32_t stringsOffset;
+        uint32_t bytesSize;
+        uint32_t bytesOffset;
+    };
+
+    // Contiguous run of PatternRecords used by one VersionFeatures::patternSet
+    struct PatternSetRecord {
+        uint32_t firstPattern;
+        uint32_t patternCount;
+    };
+
+    struct PatternRecord {
+        uint32_t nameOffset;    // into strings
+        int32_t  offset_a;      // same meaning as PatternEntry::offset_a
+        int32_t  offset_b;      // same meaning as PatternEntry::offset_b
+        uint32_t dataOffset;    // into bytes: bytes[size] then mask[size];
+                                // the BlobId when size is 0
+        uint32_t size;          // 0: pattern comes from an encrypted blob
+    };
+
+    // Byte patch applied by Hooks::ApplyHooks when the running version's
+    // VersionFeatures::patches contains patchSet.
+    struct PatchRecord {
+        uint32_t patternIndex;  // global PatternRecord index
+        int32_t  offset;        // from the match address
+        uint8_t  value;
+        uint8_t  patchSet;      // PatchSet flag
+        uint8_t  protect;       // non-zero: VirtualProtect around the write
+        uint8_t  reserved;
+    };
+
+    static_assert(sizeof(VersionInterval) == 16, "VersionInterval is part of the image format");
+    static_assert(sizeof(PatternRecord) == 20, "PatternRecord is part of the image format");
+    static_assert(sizeof(PatchRecord) == 12, "PatchRecord is part of the image format");
+
+    // One signature of a symbol with its own resolver offsets
+    struct Signature {
+        PatternScan::PatternView pattern;
+        int offset_a;
+        int offset_b;
+    };
+
+    // A symbol as seen by the resolver, regardless of where it is stored:
+    // up to kMaxAlternatives signatures in priority order (index 0 first)
+    struct PatternRef {
+        std::string_view name;
+        Signature signatures[PatternScan::kMaxAlternatives];
+        int count;
+    };
+
+    // Map a compiled image read-only. Returns false (and leaves the database
+    // unloaded) if the file is missing or its header is inconsistent.
+    // Call after EncryptedBlobs::DecryptAll: records that refer to a blob
+    // are compiled from the decrypted arena here.
+    bool Load(const char* path);
+
+    bool IsLoaded();
+
+    // Unmap the image; the built-in tables apply again. Only for callers
+    // that hold no PatternRef, VersionFeatures or name from the image (the
+    // tests), never while patterns are being resolved.
+    void Unload();
+
+    // Interval lookup over the mapped image; nullptr if not found or not loaded
+    const VersionFeatures* FindVersionFeatures(int engineVersion);
+
+    // Find a pattern by name within a pattern set of the mapped image.
+    // Records in the set sharing the name are alternatives, in priority order.
+    bool FindPattern(int patternSet, std::string_view name, PatternRef& out);
+
+    // Number of patch records and accessor (patternRef filled from the image)
+    uint32_t PatchCount();
+    bool GetPatch(uint32_t index, PatchRecord& patch, PatternRef& pattern);
+
+    // Offline compiler (tools/sigdbc): JSON source -> binary image.
+    // Returns false and fills `error` on malformed input.
+    bool CompileSource(const std::string& jsonPath, const std::string& imagePath,
+                       std::string& error);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "globals.h"
+#include <memory_resource>
+
+// Bump allocator for data that is only needed until pattern resolution
+// finishes (the built-in version configs and their pattern entries).
+//
+// Allocation is a pointer bump into blocks taken from the heap; individual
+// deallocations are no-ops. Release() hands every block back at once, after
+// which nothing allocated from the arena may be touched. Not thread-safe:
+// only InitVersionConfigs allocates from it.
+namespace StartupArena {
+    struct Stats {
+        uint64_t allocations;       // allocate() calls served by the arena
+        uint64_t bytesRequested;    // sum of their sizes
+        uint64_t blocks;            // blocks obtained from the heap
+        uint64_t bytesReserved;     // sum of the block sizes
+    };
+
+    // Resource to build startup-only pmr containers with
+    std::pmr::memory_resource* Resource();
+
+    // Counters since startup (not reset by Release)
+    Stats GetStats();
+
+    // Report the counters as startup metrics and free every block
+    void Release();
+}
@@ -2,6 +2,7 @@
 
 #include "globals.h"
 #include <string>
+#include <string_view>
 #include <vector>
 
 // String utility functions reconstructed from IDA decompilation.
@@ -29,4 +30,20 @@ std::vector<std::string> SplitString(const std::string& str, char delimiter);
 // Original: sub_180004F70
 std::string ToUpper(const std::string& str);
 
+// Not in the original binary: name comparison without narrowing.
+
+// Widen an ASCII string (each char zero-extended to wchar_t), e.g. a
+// lookup target, once, so engine wchar_t names can be compared to it
+// directly.
+std::wstring NarrowToWide(std::string_view str);
+
+// Whether `size` bytes at `a` and `b` are equal; 16 bytes per SSE2
+// compare, never reading past either range.
+bool BytesEqual(const void* a, const void* b, size_t size);
+
+// Whether the `len` wide characters at `wstr` (an engine FString buffer)
+// equal `target`: length check first, then BytesEqual. No locale, no
+// allocation.
+bool WideEquals(const wchar_t* wstr, size_t len, std::wstring_view target);
+
 } // namespace StringUtils
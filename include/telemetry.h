@@ -0,0 +1,64 @@
+#pragma once
+
+#include "globals.h"
+#include "pattern_scan.h"
+#include <string>
+#include <string_view>
+
+// Structured per-scan telemetry.
+//
+// Every pattern resolution appends one ScanRecord to a fixed-size,
+// lock-free in-process buffer (any thread may record; records past the
+// capacity are counted and dropped). The buffer can be dumped as JSON lines
+// so scan cost and ambiguous signatures can be compared across machines.
+// A small table of named counters carries the other startup metrics.
+namespace Telemetry {
+    static constexpr size_t kCapacity = 256;
+
+    struct ScanRecord {
+        char name[32];                  // pattern name (truncated)
+        int engineVersion;              // Globals::dword_18004FDE0 at record time
+        int patternSet;                 // VersionFeatures::patternSet, -1 if none
+        PatternScan::ScanTier tier;
+        bool exhaustive;                // matchCount covers the whole image
+        uint64_t bytesScanned;
+        uint64_t candidatesTested;
+        int alternative;                // winning signature index, -1 if none
+        uint32_t matchCount;
+        uint64_t wallTimeNs;
+        uint64_t rva;                   // final resolved address - module base, 0 if failed
+    };
+
+    // Whether scans should count every match (default: on in debug builds)
+    bool ExhaustiveScans();
+    void SetExhaustiveScans(bool enabled);
+
+    // Append a record. `resolved` is the final address after any RIP/offset
+    // resolution, 0 if the scan failed.
+    void RecordScan(std::string_view name, int patternSet,
+                    const PatternScan::ScanStats& stats,
+                    uintptr_t resolved, HMODULE module);
+
+    // Copy out the records written so far; returns the number copied
+    size_t Snapshot(ScanRecord* out, size_t maxRecords);
+
+    // Records and counters that did not fit in their buffers
+    size_t DroppedCount();
+
+    // Named startup metric (e.g. "startupArena.allocations"); setting an
+    // existing name overwrites its value. At most kMaxCounters names.
+    static constexpr size_t kMaxCounters = 32;
+    void SetCounter(std::string_view name, uint64_t value);
+
+    // Write all records to `path` as JSON lines (overwrites the file),
+    // followed by one line per counter
+    bool Dump(const std::string& path);
+
+    // <config path>\rift_telemetry.jsonl
+    std::string DefaultDumpPath();
+
+    // Whether the startup dump should be written: always in debug builds,
+    // otherwise only when DefaultDumpPath() already exists (create an empty
+    // file there to opt in)
+    bool DumpRequested();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "globals.h"
+#include <future>
+#include <memory>
+#include <type_traits>
+
+// Small worker pool for startup work (pattern scans, prefetches).
+//
+// Workers are created on the first Submit and then idle on a condition
+// variable for the lifetime of the process. Tasks run in submission order
+// across the available workers.
+namespace ThreadPool {
+    // Number of workers the pool runs (at least 2, at most 4)
+    unsigned WorkerCount();
+
+    // Pool tasks to run next to the calling thread when it splits work into
+    // `blocks` parts: at most WorkerCount(), no more than the cores left
+    // beside the caller, and none for a single block (on a single core the
+    // caller does everything, although the pool still runs 2 workers)
+    unsigned HelperCount(size_t blocks);
+
+    // Queue a type-erased task. Returns false if no worker could be started,
+    // in which case the task has already been run on the calling thread.
+    bool Enqueue(std::function<void()> task);
+
+    // Queue a callable and get a future for its result
+    template <typename F>
+    auto Submit(F&& fn) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(fn));
+        std::future<Result> future = task->get_future();
+        Enqueue([task]() { (*task)(); });
+        return future;
+    }
+}
@@ -1,7 +1,15 @@
 #pragma once
 
 #include "globals.h"
+#include "name_cache.h"
+#include <atomic>
+#include <cstring>
+#include <functional>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace UE4 {
     // Get GWorld pointer value
@@ -14,35 +22,366 @@ namespace UE4 {
 
     // Convert FName to std::string
     // Calls the resolved FNameToString function pointer (qword_18004FDC8)
-    // then narrows the result from wchar_t to char via sub_180005030
+    // then narrows the result from wchar_t to char via sub_180005030;
+    // results are cached in NameCache
     std::string FNameToString(int nameIndex);
 
     // Get the name string of a UObject at the given address
     // Reads FName at object + 24, calls FNameToString, and narrows
-    // Used internally by GObjects search functions
+    // (through NameCache). Used internally by GObjects search functions
     std::string GetObjectName(__int64 objectPtr);
 
+    // The same name as a handle to its NameCache entry, for sweeps that
+    // only read it: no allocation or character copy on a cache hit
+    NameCache::Name GetObjectNameRef(__int64 objectPtr);
+
+    // The name a raw 8-byte FName value stands for, through NameCache.
+    // Names are never freed by the engine, so this also works for the
+    // FName of an object that is gone.
+    NameCache::Name GetNameRef(uint64_t fname);
+
+    // Layout of the GObjects array captured once per sweep. For the chunked
+    // (type 2) layout this locates the run of valid chunk pointers a single
+    // time instead of once per element as sub_1800063A0 does.
+    struct ObjectTable {
+        unsigned char type;      // PatternLink type: 1 flat, 2 chunked, 0 unresolved
+        int count;               // slot count
+        __int64 flatArray;       // type 1: element array
+        const __int64* chunks;   // type 2: first valid chunk pointer
+        int chunkCount;          // type 2: valid chunks starting at `chunks`
+
+        // From the current PatternLink (qword_18004FDF0)
+        static ObjectTable Capture();
+        static ObjectTable Capture(unsigned char type, __int64 gobjectsBase);
+    };
+
+    // Forward iterator over the non-empty slots of an ObjectTable, in index
+    // order, for both layouts:
+    //     for (ObjectIterator it(table); it.Next();)
+    //         use(it.Object(), it.Index());
+    // Advances a pointer slot by slot and switches chunk at chunk borders;
+    // no per-element division or chunk rescan.
+    class ObjectIterator {
+    public:
+        explicit ObjectIterator(const ObjectTable& table);
+
+        // Start at slot `first` instead of 0 (one division to locate it)
+        ObjectIterator(const ObjectTable& table, int first);
+
+        bool Next();
+        int Index() const { return m_index; }
+        __int64 Object() const { return m_object; }
+
+        // FUObjectItem::SerialNumber of the current slot; 0 until the
+        // engine hands out a weak pointer to the object
+        int Serial() const;
+
+    private:
+        const ObjectTable& m_table;
+        int m_index = -1;
+        __int64 m_object = 0;
+        __int64 m_slot = 0;      // address of the current slot
+        __int64 m_chunkEnd = 0;  // type 2: address of the last slot in the chunk
+        int m_chunk = -1;        // type 2: chunk holding the current slot
+    };
+
+    // Walk the non-empty slots of `table` on the calling thread plus the
+    // ThreadPool workers. Slots are handed out in fixed blocks in index
+    // order; `visit(object, index)` runs concurrently and returns true for
+    // a match, after which slots past the lowest match so far are skipped.
+    // Returns the lowest matching index (independent of scheduling), or -1
+    // once every slot was visited without a match.
+    int ParallelSweep(const ObjectTable& table,
+                      const std::function<bool(__int64 object, int index)>& visit);
+
+    // GObjects slot count for the active PatternLink layout (0 if GObjects
+    // is not resolved) and the object in one slot (0 for an empty slot)
+    int GetObjectCount();
+    __int64 GetObjectByIndex(int index);
+
+    // Raw 8-byte FName at object + 24 and Outer at object + 32
+    uint64_t GetObjectFName(__int64 objectPtr);
+    __int64 GetObjectOuter(__int64 objectPtr);
+
     // Find a UObject by name in GObjects array
     // Original: sub_1800072D0 - uses PatternLink type byte to dispatch:
     //   type 1 -> sub_1800056F0 (linear GObjects array, 24-byte stride)
     //   type 2 -> sub_180006450 (chunked GObjects array via sub_1800063A0)
+    // Answered from ObjectIndex when possible; the sweep is the fallback.
     __int64 StaticFindObject(const char* name);
 
+    // Whether a miss in StaticFindObject, FindPropertyOffset or the SDK's
+    // own batches shows the "Value is NULL" MessageBoxA (the default). The
+    // test target turns it off so a failing check can't block the run.
+    void SetLookupBoxes(bool show);
+
     // Find property offset from class + property name pair
     // Original: sub_180007790 - uses PatternLink type to dispatch:
     //   type 1 -> sub_180005F70 (linear iteration, offset at +68)
     //   type 2 -> sub_180006CA0 (chunked iteration or property chain walk)
     // Returns: byte offset of the property within the class (from UProperty + 68 or + 76)
+    // Answered from the property offset cache when the pair was resolved
+    // before; otherwise object-sweep layouts and the class lookup of the
+    // property chain walk go through ObjectIndex first.
     int FindPropertyOffset(const char* className, const char* propertyName);
 
+    // One object to resolve in a batch; `result` stays 0 on a miss
+    struct ObjectQuery {
+        const char* name;
+        __int64 result;
+    };
+
+    // One (class, property) pair to resolve in a batch; `found` is false on
+    // a miss
+    struct PropertyQuery {
+        const char* className;
+        const char* propertyName;
+        int offset;
+        bool found;
+    };
+
+    // FindPropertyOffset without the MessageBoxA: the offset cache, then a
+    // one-query FindBatch whose hit is cached. False on a miss.
+    bool TryFindPropertyOffset(const char* className, const char* propertyName, int& offset);
+
+    // Resolve every query together: ObjectIndex first, then a single
+    // GObjects sweep shared by whatever is left (plus one property chain
+    // walk per class on PropertyLink layouts). Shows no MessageBoxA;
+    // returns the number of misses, which the caller reports.
+    size_t FindBatch(ObjectQuery* objects, size_t objectCount,
+                     PropertyQuery* properties, size_t propertyCount);
+
+    // TArray as laid out by the engine: { T* Data; int32 Num; int32 Max; }
+    template <typename T>
+    struct TArray {
+        T* data;
+        int count;
+        int max;
+
+        int Num() const { return count; }
+        bool IsValidIndex(int index) const { return data && index >= 0 && index < count; }
+        T& operator[](int index) const { return data[index]; }
+    };
+
+    // Declares a property descriptor for Prop<>, e.g.
+    //     UE4_PROPERTY(World, OwningGameInstance, __int64);
+    // defines struct World_OwningGameInstance naming the class, the
+    // property and the C++ type of the field.
+#define UE4_PROPERTY(Class, Property, FieldType)                  \
+    struct Class##_##Property {                                    \
+        static constexpr const char* className = #Class;           \
+        static constexpr const char* propertyName = #Property;     \
+        using Type = FieldType;                                    \
+    }
+
+    // Properties the SDK reads
+    namespace Fields {
+        UE4_PROPERTY(World, OwningGameInstance, __int64);
+        UE4_PROPERTY(GameInstance, LocalPlayers, TArray<__int64>);
+        UE4_PROPERTY(LocalPlayer, ViewportClient, __int64);
+        UE4_PROPERTY(GameViewportClient, ViewportConsole, __int64);
+    }
+
+    // Typed access to the property described by `Field`:
+    //     __int64 gameInstance = Prop<Fields::World_OwningGameInstance>::Get(world);
+    //     Prop<Fields::GameViewportClient_ViewportConsole>::Get(client) = console;
+    // The offset is looked up through TryFindPropertyOffset (a cache hit
+    // after InitializeSDK) and kept in a function-local static, so later
+    // calls are one load. A miss shows no MessageBoxA and is looked up again
+    // at most once per RETRY_MS, once the class may have loaded. Get()
+    // returns a reference to the field, which may be any type (pointer,
+    // TArray, struct); check Resolved() first where the class may be
+    // missing, as Get() on an unresolved field is the object itself.
+    template <typename Field>
+    struct Prop {
+        using Type = typename Field::Type;
+
+        static constexpr unsigned long long RETRY_MS = 1000;
+
+        // Offset of the field, or 0 while it is not found
+        static int TryOffset()
+        {
+            static std::atomic<int> offset{0};
+            static std::atomic<unsigned long long> lastMiss{0};
+
+            int resolved = offset.load(std::memory_order_relaxed);
+            if (resolved)
+                return resolved;
+
+            unsigned long long now = GetTickCount64();
+            unsigned long long last = lastMiss.load(std::memory_order_relaxed);
+            if (last && now - last < RETRY_MS)
+                return 0;
+
+            if (TryFindPropertyOffset(Field::className, Field::propertyName, resolved))
+                offset.store(resolved, std::memory_order_relaxed);
+            else
+                lastMiss.store(now ? now : 1, std::memory_order_relaxed);
+            return resolved;
+        }
+
+        static bool Resolved() { return TryOffset() != 0; }
+
+        static Type& Get(__int64 object)
+        {
+            return *reinterpret_cast<Type*>(object + TryOffset());
+        }
+    };
+
+    // A UFunction and the layout of its parameter struct, read from the
+    // function's parameter properties when it is first resolved
+    struct FunctionInfo {
+        struct Param {
+            std::string name;
+            int offset;
+            int size;           // ElementSize * ArrayDim
+            uint64_t flags;     // EPropertyFlags (CPF_Parm, CPF_OutParm, ...)
+        };
+
+        __int64 function;             // UFunction*
+        int paramsSize;               // bytes, rounded up to 8
+        std::vector<Param> params;    // declaration order
+        std::vector<int> inputs;      // indices of the non-return params
+        int returnParam;              // index of the return value, or -1
+
+        // Offset of the named parameter, or -1
+        int ParamOffset(std::string_view name) const;
+    };
+
+    // Resolve "Class:Function" (e.g. "GameplayStatics:SpawnObject").
+    // Results are cached for the process; misses are not, so a function
+    // whose class loads later is found on a later call. nullptr on a miss.
+    const FunctionInfo* FindFunction(const char* qualifiedName);
+
+    // ProcessEvent with a parameter struct laid out as `info` describes
+    void Invoke(__int64 object, const FunctionInfo& info, void* params);
+
+    // Handle to a UFunction that resolves on first use and afterwards calls
+    // ProcessEvent without any string work:
+    //     static UE4::FunctionHandle spawnObject("GameplayStatics:SpawnObject");
+    //     __int64 obj = spawnObject.Call<__int64>(statics, objectClass, outer);
+    // Call() writes its arguments into the non-return parameters in
+    // declaration order and returns the return parameter. It does nothing
+    // (and returns Ret{}) if the function is not resolved or the argument
+    // count or sizes don't match the parameters.
+    class FunctionHandle {
+    public:
+        explicit FunctionHandle(const char* qualifiedName) : m_name(qualifiedName) {}
+
+        // Resolved function, or nullptr (retried on the next call)
+        const FunctionInfo* Resolve() const;
+
+        template <typename Ret = void, typename... Args>
+        Ret Call(__int64 object, const Args&... args) const
+        {
+            static_assert((std::is_trivially_copyable_v<Args> && ...),
+                          "ProcessEvent arguments are copied bytewise");
+
+            const FunctionInfo* info = Resolve();
+            if (!info || info->inputs.size() != sizeof...(Args))
+                return Ret();
+
+            const size_t sizes[] = {sizeof(Args)..., 0};
+            const void* values[] = {static_cast<const void*>(&args)..., nullptr};
+            for (size_t i = 0; i < sizeof...(Args); ++i)
+            {
+                if (sizes[i] > static_cast<size_t>(info->params[info->inputs[i]].size))
+                    return Ret();
+            }
+
+            // Parameter structs are small; large ones go to the heap
+            alignas(16) unsigned char local[kLocalParams];
+            std::vector<unsigned char> heap;
+            unsigned char* params = local;
+            if (info->paramsSize > kLocalParams)
+            {
+                heap.resize(info->paramsSize);
+                params = heap.data();
+            }
+            std::memset(params, 0, info->paramsSize);
+
+            for (size_t i = 0; i < sizeof...(Args); ++i)
+                std::memcpy(params + info->params[info->inputs[i]].offset, values[i], sizes[i]);
+
+            Invoke(object, *info, params);
+
+            if constexpr (!std::is_void_v<Ret>)
+            {
+                static_assert(std::is_trivially_copyable_v<Ret>,
+                              "ProcessEvent results are copied bytewise");
+                Ret result{};
+                if (info->returnParam >= 0)
+                {
+                    const FunctionInfo::Param& ret = info->params[info->returnParam];
+                    size_t size = sizeof(Ret) < static_cast<size_t>(ret.size) ? sizeof(Ret) : ret.size;
+                    std::memcpy(&result, params + ret.offset, size);
+                }
+                return result;
+            }
+        }
+
+    private:
+        static constexpr int kLocalParams = 256;
+
+        const char* m_name;
+        mutable std::atomic<const FunctionInfo*> m_info{nullptr};
+    };
+
+    // UClass of an object (ClassPrivate at object + 16)
+    __int64 GetObjectClass(__int64 objectPtr);
+
+    // Whether the active layout keeps properties on a chain off
+    // UStruct + 80 (PropertyLink layouts, version >= 11794982) rather than
+    // as UProperty objects in GObjects whose Outer is the owning struct
+    bool UsesPropertyChain();
+
+    // One property of a class, struct or function, from either layout
+    struct PropertyInfo {
+        std::string name;
+        std::string type;       // property class, e.g. "IntProperty"
+        int offset;
+        int arrayDim;
+        int elementSize;
+        uint64_t flags;         // EPropertyFlags
+    };
+
+    // Fields of a UProperty object (object sweep layouts)
+    PropertyInfo ReadPropertyObject(__int64 prop);
+
+    // Append the properties on the chain of `structObj` in chain order
+    // (PropertyLink layouts); stops at the first node that can't be read
+    void ReadPropertyChain(__int64 structObj, std::vector<PropertyInfo>& out);
+
+    // UStruct::SuperStruct and UStruct::PropertiesSize; both 0 if the
+    // struct can't be read
+    struct StructLayout {
+        __int64 super;
+        int size;
+    };
+    StructLayout ReadStructLayout(__int64 structObj);
+
+    // Append the (name, value) pairs of UEnum::Names; false if the array
+    // can't be read
+    bool ReadEnumNames(__int64 enumObj, std::vector<std::pair<std::string, int64_t>>& out);
+
+    // Forget every object, name and property offset learned from the
+    // current GObjects (ObjectIndex, NameCache, the FName memo and the
+    // offset cache), for when a different GObjects is installed. Resolved
+    // FunctionHandles point into the function cache, so it is kept.
+    void ResetCaches();
+
     // Initialize console and viewport setup
     // Original: sub_18000E8A0
     // Navigates: World -> OwningGameInstance -> GameInstance -> LocalPlayers
     //            -> LocalPlayer -> ViewportClient
     // Then creates Console object and assigns it to ViewportConsole
+    // Objects are resolved with one FindBatch call, fields are read through
+    // Prop<> accessors, after checking every offset was found
     unsigned int InitConsoleAndViewport();
 
     // Initialize UE4 SDK (resolve all property offsets)
     // Corresponds to sub_180007CB0
+    // Builds the GObjects index and resolves every g_SdkProperties entry in
+    // a single pass; later FindPropertyOffset calls are cache lookups
     void InitializeSDK();
 }
@@ -1,33 +1,177 @@
 #pragma once
 
 #include "globals.h"
+#include "pattern_scan.h"
+#include "lazy_pattern.h"
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
+// The config types below are allocator-aware so InitVersionConfigs can
+// build them (strings included) in the startup arena; see startup_arena.h.
+using StartupAllocator = std::pmr::polymorphic_allocator<char>;
+
+// Fallback signature for a PatternEntry, with its own resolver offsets
+struct PatternAlternative {
+    using allocator_type = StartupAllocator;
+
+    std::pmr::string pattern;
+    int offset_a;
+    int offset_b;
+    PatternScan::CompiledPattern compiled;
+
+    PatternAlternative(const char* pattern, int offset_a, int offset_b,
+                       const allocator_type& alloc = {})
+        : pattern(pattern, alloc), offset_a(offset_a), offset_b(offset_b), compiled() {}
+    PatternAlternative(const PatternAlternative& other, const allocator_type& alloc = {})
+        : pattern(other.pattern, alloc), offset_a(other.offset_a),
+          offset_b(other.offset_b), compiled(other.compiled) {}
+    PatternAlternative(PatternAlternative&& other, const allocator_type& alloc)
+        : pattern(std::move(other.pattern), alloc), offset_a(other.offset_a),
+          offset_b(other.offset_b), compiled(other.compiled) {}
+};
+
 // PatternEntry: 72 bytes in original binary
 // Layout: name (std::string, 32 bytes) + pattern (std::string, 32 bytes) + offset_a (int, 4) + offset_b (int, 4)
+// `compiled` is not part of the original layout; it holds the byte/mask form
+// built once in InitVersionConfigs so resolution never re-parses the string.
+// `alternatives` (also not original) are lower-priority signatures for the
+// same symbol, tried in the same sweep as the primary pattern; at most
+// PatternScan::kMaxAlternatives - 1 are used.
 struct PatternEntry {
-    std::string name;      // offset 0: pattern identifier (e.g., "GObjects")
-    std::string pattern;   // offset 32: IDA-style hex pattern string
-    int offset_a;          // offset 64: RIP-relative displacement offset (0 = no resolution)
-    int offset_b;          // offset 68: additional offset adjustment
+    using allocator_type = StartupAllocator;
+
+    std::pmr::string name;      // offset 0: pattern identifier (e.g., "GObjects")
+    std::pmr::string pattern;   // offset 32: IDA-style hex pattern string (empty for encrypted entries)
+    int offset_a;               // offset 64: RIP-relative displacement offset (0 = no resolution)
+    int offset_b;               // offset 68: additional offset adjustment
+    PatternScan::CompiledPattern compiled;
+    std::pmr::vector<PatternAlternative> alternatives;
+
+    PatternEntry(const char* name, const char* pattern, int offset_a, int offset_b,
+                 const allocator_type& alloc = {})
+        : name(name, alloc), pattern(pattern, alloc), offset_a(offset_a),
+          offset_b(offset_b), compiled(), alternatives(alloc) {}
+    PatternEntry(const PatternEntry& other, const allocator_type& alloc = {})
+        : name(other.name, alloc), pattern(other.pattern, alloc),
+          offset_a(other.offset_a), offset_b(other.offset_b),
+          compiled(other.compiled), alternatives(other.alternatives, alloc) {}
+    PatternEntry(PatternEntry&& other, const allocator_type& alloc)
+        : name(std::move(other.name), alloc), pattern(std::move(other.pattern), alloc),
+          offset_a(other.offset_a), offset_b(other.offset_b),
+          compiled(other.compiled), alternatives(std::move(other.alternatives), alloc) {}
 };
 
 // VersionConfig: stored as value in std::map keyed by version_min
 // Original tree node is 0x40 bytes: tree pointers (24) + color/nil flags (8) + data (32)
 // Data portion: version_min (int) + version_max (int) + pattern_list (std::vector<PatternEntry>)
 struct VersionConfig {
+    using allocator_type = StartupAllocator;
+
     int version_min;
     int version_max;
-    std::vector<PatternEntry> patterns;
+    std::pmr::vector<PatternEntry> patterns;
+
+    explicit VersionConfig(const allocator_type& alloc = {})
+        : version_min(0), version_max(0), patterns(alloc) {}
+    VersionConfig(VersionConfig&& other, const allocator_type& alloc)
+        : version_min(other.version_min), version_max(other.version_max),
+          patterns(std::move(other.patterns), alloc) {}
+};
+
+// How the GObjects address resolved from the pattern is turned into the
+// PatternLink structure (qword_18004FDF0). Older engines need a forward scan
+// for an int32 -1 sentinel followed by a fixed back-off.
+enum class GObjectsLayout : unsigned char {
+    None,        // no adjustment, no PatternLink (>= 4464155)
+    Flat24,      // PatternLink type 1, sentinel - 24
+    Chunked32,   // PatternLink type 2, sentinel - 32
+    Chunked16,   // PatternLink type 2, sentinel - 16
+};
+
+// How FindPropertyOffset locates a property on a type 2 layout
+enum class PropertyChainMode : unsigned char {
+    ObjectSweep,    // search GObjects for the property object, offset at +0x44
+    PropertyLink,   // walk UStruct::PropertyLink of the class, offset at +0x4C
+};
+
+// Version-specific patches applied by MainGameSetup (bit flags)
+enum PatchSet : unsigned char {
+    PATCH_NONE       = 0,
+    PATCH_RET_STUB   = 1 << 0,   // 3700114: patch a function to RET
+    PATCH_BYTE_FLAGS = 1 << 1,   // 5914491 - 14786821: two byte patches (ApplyHooks)
 };
 
+// Everything that depends on the engine changelist, in one place
+struct VersionFeatures {
+    int patternSet;                   // index of the VersionConfig to resolve
+    GObjectsLayout gobjectsLayout;
+    PropertyChainMode propertyChain;
+    unsigned char patches;            // PatchSet flags
+};
+
+// One row of the sorted, disjoint CL interval table
+struct VersionInterval {
+    int version_min;
+    int version_max;
+    VersionFeatures features;
+};
+
+// The five per-version patterns resolved by InitializePatterns
+enum class PatternId : int {
+    GObjects,       // qword_18004FDD8 (after the PatternLink adjustment)
+    ProcessEvent,   // qword_18004FDE8
+    FNameToString,  // qword_18004FDC8
+    GWorld,         // qword_18004FDB0
+    InputKey,       // qword_18004FDA8
+    Count
+};
+
+namespace SignatureDB { struct PatternRef; }
+
 namespace VersionManager {
+    // Look up the feature descriptor for a changelist.
+    // Binary search over the signature database when one is loaded,
+    // otherwise over the built-in interval table; nullptr if unsupported.
+    const VersionFeatures* FindVersionFeatures(int engineVersion);
+
+    // Branch-light binary search over any sorted, disjoint interval array
+    const VersionFeatures* SearchIntervals(const VersionInterval* table,
+                                           size_t count, int engineVersion);
+
+    // Descriptor for the running engine (Globals::dword_18004FDE0)
+    const VersionFeatures* CurrentFeatures();
+
+    // The built-in interval table, whether or not a database is loaded
+    const VersionInterval* BuiltinIntervals(size_t& count);
+
+    // A pattern of a built-in config by name, alternatives included; false
+    // if InitVersionConfigs has not run, the startup arena was released or
+    // the set has no such pattern
+    bool FindBuiltinPattern(int patternSet, std::string_view name,
+                            SignatureDB::PatternRef& out);
+
     // Initialize the version config tree (sub_180001020 equivalent)
-    // Populates the global tree at qword_180050050 with all 9 version configs
+    // Populates the global tree at qword_180050050 with all 9 version configs,
+    // allocated from the startup arena
     void InitVersionConfigs();
 
     // Resolve all patterns for the current engine version
     // Original: sub_180027620
+    // GObjects, ProcessEvent, FNameToString and GWorld run concurrently on
+    // the startup thread pool; only GWorld is waited for before returning.
+    // InputKey is prefetched by ResolveDeferredPatterns.
     int InitializePatterns();
+
+    // Lazy handle for one of the version patterns. Get() resolves it (or
+    // joins the prefetch) and also fills the matching Globals slot.
+    PatternScan::LazyPattern& GetPattern(PatternId id);
+
+    // Wait for the pattern tasks started by InitializePatterns, run the
+    // original validation once and release the startup arena (the built-in
+    // configs are unreachable afterwards). Called at the start of MainGameSetup.
+    // Does not wait for InputKey; it starts the InputKey scan in the
+    // background instead, which reports a mismatch when it completes.
+    void ResolveDeferredPatterns();
 }
@@ -16,9 +16,17 @@
 #include "version_config.h"
 #include "string_utils.h"
 #include "game_logic.h"
+#include "hooks.h"
+#include "encrypted_blobs.h"
+#include "signature_db.h"
 
 #include <cstdlib>
 #include <cerrno>
+#include <cstring>
+
+// MSVC CRT instruction-set level; dword_18004F028 in the original binary
+// is this variable itself.
+extern "C" int __isa_available;
 
 // ============================================================================
 // Global variable definitions
@@ -205,10 +213,35 @@ pattern_found:
         }
     }
 
-    // Step 8: Initialize version configs and resolve patterns
+    // Step 8: Decrypt every embedded pattern blob into the read-only arena,
+    // then initialize version configs and resolve patterns
+    Globals::dword_18004F028 = __isa_available;
+    if (!EncryptedBlobs::DecryptAll())
+        return;
+
+    // An optional signatures.rsdb next to the DLL (compiled by tools/sigdbc)
+    // replaces the built-in version table, patterns and patches
+    char dbPath[MAX_PATH];
+    DWORD pathLen = GetModuleFileNameA(static_cast<HMODULE>(lpThreadParameter),
+                                       dbPath, MAX_PATH);
+    if (pathLen && pathLen < MAX_PATH)
+    {
+        char* slash = strrchr(dbPath, '\\');
+        size_t dirLen = slash ? static_cast<size_t>(slash - dbPath + 1) : 0;
+        const char kDbName[] = "signatures.rsdb";
+        if (dirLen + sizeof(kDbName) <= MAX_PATH)
+        {
+            memcpy(dbPath + dirLen, kDbName, sizeof(kDbName));
+            SignatureDB::Load(dbPath);
+        }
+    }
+
     VersionManager::InitVersionConfigs();
     VersionManager::InitializePatterns();
 
+    // Scan for the remaining hook targets while waiting for GWorld
+    Hooks::PrefetchHookTargets(Globals::dword_18004FDE0);
+
     // Step 9: Wait for GWorld to be valid
     // Original: while ( !*(_QWORD *)qword_18004FDB0 ) Sleep(0x3E8u);
     while (!*reinterpret_cast<__int64*>(Globals::qword_18004FDB0))
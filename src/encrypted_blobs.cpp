@@ -0,0 +1,243 @@
+/*
+ * Rift DLL - Encrypted Pattern Blobs
+ *
+ * Every XOR-encrypted pattern string embedded in the original binary, in one
+ * registry. The original decrypts these inline where they are used:
+ *   sub_1800282B0 - hook patterns (copied to the stack, SSE-decrypted)
+ *   sub_180001020 - InputKey patterns (decrypted into std::string)
+ *
+ * Here DecryptAll lays every blob out in a single arena and decrypts the
+ * whole arena with one Hooks::DecryptPattern call. Each blob starts at a
+ * multiple of 51 bytes, so the running key (i % 51) + 52 over the arena is
+ * exactly the per-blob key each blob was encrypted with. The arena is then
+ * made read-only and handed out as string_views.
+ */
+
+#include "encrypted_blobs.h"
+#include "hooks.h"
+#include <cstring>
+
+// ============================================================================
+// Encrypted pattern blobs from .rdata (extracted from binary)
+// These are XOR-encrypted with key (i % 51) + 52
+// ============================================================================
+
+// 64-byte encrypted pattern (xmmword_1800461D0..180046200)
+// Decrypts to: "48 8B C8 48 8B 47 30 48 39 14 C8 0F 85 ? ? ? ? 80 BE ? ? ? ? 03"
+// Used for versions: general (5914491 - 14786821 range)
+static const unsigned char encrypted_pattern_64[64] = {
+    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x03,
+    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x03, 0x62, 0x77,
+    0x73, 0x65, 0x75, 0x77, 0x68, 0x7D, 0x72, 0x6B,
+    0x7F, 0x74, 0x6E, 0x7E, 0x64, 0x71, 0x11, 0x6B,
+    0x74, 0x65, 0x10, 0x77, 0x60, 0x6C, 0x7A, 0x64,
+    0x7C, 0x62, 0x7E, 0x60, 0x40, 0x5E, 0x42, 0x5B,
+    0x54, 0x45, 0x24, 0x71, 0x15, 0x09, 0x17, 0x07,
+    0x19, 0x05, 0x1B, 0x03, 0x1D, 0x0E, 0x0C, 0x40,
+};
+
+// 95-byte encrypted pattern (xmmword_180046990..1800469D0 + 15 bytes)
+// Decrypts to: "48 89 5C 24 ? 48 89 74 24 ? 57 48 83 EC ? 48 8B F1 41 8B D8 48 8B 0D ? ? ? ? 48 8B FA 48 85 C9"
+// Used for AdditionalHookFunc (qword_18004FDB8)
+static const unsigned char encrypted_pattern_95[95] = {
+    0x00, 0x0D, 0x16, 0x0F, 0x01, 0x19, 0x0F, 0x78,
+    0x1C, 0x0F, 0x0A, 0x1F, 0x7F, 0x61, 0x76, 0x7B,
+    0x64, 0x7D, 0x7F, 0x67, 0x7F, 0x7D, 0x6A, 0x79,
+    0x78, 0x6D, 0x71, 0x6F, 0x65, 0x66, 0x72, 0x67,
+    0x6C, 0x75, 0x6E, 0x64, 0x78, 0x1C, 0x19, 0x7B,
+    0x63, 0x7D, 0x6A, 0x67, 0x40, 0x59, 0x20, 0x43,
+    0x22, 0x54, 0x46, 0x00, 0x04, 0x16, 0x0F, 0x7A,
+    0x19, 0x7E, 0x03, 0x1C, 0x09, 0x06, 0x1F, 0x78,
+    0x03, 0x62, 0x73, 0x00, 0x65, 0x79, 0x67, 0x77,
+    0x69, 0x75, 0x6B, 0x73, 0x6D, 0x7A, 0x77, 0x70,
+    0x69, 0x10, 0x73, 0x12, 0x14, 0x76, 0x63, 0x60,
+    0x79, 0x62, 0x6E, 0x7C, 0x1E, 0x67, 0x5F,
+};
+
+// 84-byte encrypted pattern (xmmword_180046AC0..180046B00 + 4 bytes)
+// Decrypts to: "48 8B C4 48 89 58 ? 48 89 70 ? 48 89 78 ? 55 48 8D 68 ? 48 81 EC ? ? ? ? 48 8B ? 7F"
+// Used for AdditionalAddr (qword_18004FDD0)
+static const unsigned char encrypted_pattern_84[84] = {
+    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
+    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
+    0x7C, 0x65, 0x79, 0x67, 0x7C, 0x71, 0x6A, 0x73,
+    0x75, 0x6D, 0x79, 0x7F, 0x70, 0x6E, 0x72, 0x67,
+    0x6C, 0x75, 0x6E, 0x6E, 0x78, 0x6E, 0x62, 0x7B,
+    0x63, 0x7D, 0x6B, 0x6A, 0x40, 0x55, 0x5A, 0x43,
+    0x5C, 0x21, 0x46, 0x02, 0x0D, 0x16, 0x08, 0x18,
+    0x0D, 0x02, 0x1B, 0x04, 0x0C, 0x1E, 0x7A, 0x03,
+    0x61, 0x7D, 0x63, 0x7B, 0x65, 0x79, 0x67, 0x77,
+    0x69, 0x7E, 0x73, 0x6C, 0x75, 0x0C, 0x6F, 0x6F,
+    0x71, 0x65, 0x15, 0x54,
+};
+
+// 45-byte encrypted pattern (xmmword_180046FD0 + associated data)
+// Decrypts to: "80 BB ? ? ? ? 03 75 ? 8B 83 ? ? ? ? 48 8B CB"
+// Used for specific version range byte patching
+static const unsigned char encrypted_pattern_45[45] = {
+    0x0C, 0x05, 0x16, 0x75, 0x7A, 0x19, 0x05, 0x1B,
+    0x03, 0x1D, 0x01, 0x1F, 0x7F, 0x61, 0x72, 0x70,
+    0x64, 0x72, 0x73, 0x67, 0x77, 0x69, 0x72, 0x09,
+    0x6C, 0x75, 0x7D, 0x6F, 0x6F, 0x71, 0x6D, 0x73,
+    0x6B, 0x75, 0x69, 0x77, 0x6C, 0x61, 0x7A, 0x63,
+    0x1E, 0x7D, 0x1D, 0x1D, 0x60,
+};
+
+// Blob 1: 87 bytes (configs 1) - from xmmword_180046930..180046970 + "qbctabW"
+// Decrypts to: "48 8B C4 48 89 58 08 48 89 68 10 48 89 70 18 48 89 78 20 41 56 48 81 EC F0 00 00 00 44"
+static const unsigned char g_InputKeyBlob1[87] = {
+    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
+    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
+    0x7C, 0x65, 0x76, 0x7F, 0x68, 0x7D, 0x72, 0x6B,
+    0x74, 0x74, 0x6E, 0x79, 0x68, 0x71, 0x63, 0x63,
+    0x74, 0x61, 0x6E, 0x77, 0x60, 0x60, 0x7A, 0x6C,
+    0x6C, 0x7D, 0x6F, 0x67, 0x40, 0x55, 0x5A, 0x43,
+    0x5C, 0x5C, 0x46, 0x03, 0x0D, 0x16, 0x05, 0x08,
+    0x19, 0x0E, 0x0A, 0x1C, 0x08, 0x08, 0x1F, 0x74,
+    0x79, 0x62, 0x7B, 0x75, 0x65, 0x03, 0x04, 0x68,
+    0x0F, 0x7A, 0x6B, 0x7C, 0x7D, 0x6E, 0x7F, 0x60,
+    0x71, 0x62, 0x63, 0x74, 0x61, 0x62, 0x57
+};
+
+// Blob 2: 75 bytes (configs 2-6) - from xmmword_1800468B0 + string constants
+// Decrypts to: "48 8B C4 48 89 58 10 48 89 70 18 48 89 78 20 41 56 48 81 EC F0 00 00 00 44"
+static const unsigned char g_InputKeyBlob2[75] = {
+    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
+    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
+    0x7C, 0x65, 0x77, 0x77, 0x68, 0x7D, 0x72, 0x6B,
+    0x74, 0x74, 0x6E, 0x78, 0x60, 0x71, 0x63, 0x6B,
+    0x74, 0x61, 0x6E, 0x77, 0x60, 0x60, 0x7A, 0x6C,
+    0x64, 0x7D, 0x6C, 0x6F, 0x40, 0x55, 0x53, 0x43,
+    0x51, 0x53, 0x46, 0x00, 0x0D, 0x16, 0x0F, 0x09,
+    0x19, 0x7F, 0x78, 0x1C, 0x7B, 0x0E, 0x1F, 0x70,
+    0x71, 0x62, 0x73, 0x74, 0x65, 0x76, 0x77, 0x68,
+    0x7D, 0x7E, 0x4B
+};
+
+// Blob 3: 82 bytes (config 7) - from xmmword_180046DC0 + mixed constants
+// Decrypts to: "48 8B C4 48 89 58 10 48 89 78 18 55 41 56 41 57 48 8D 68 ? 48 81 EC ? ? ? ? 44 0F"
+static const unsigned char g_InputKeyBlob3[82] = {
+    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
+    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
+    0x7C, 0x65, 0x77, 0x77, 0x68, 0x7D, 0x72, 0x6B,
+    0x74, 0x74, 0x6E, 0x78, 0x68, 0x71, 0x63, 0x6B,
+    0x74, 0x60, 0x63, 0x77, 0x6C, 0x68, 0x7A, 0x6E,
+    0x6A, 0x7D, 0x6A, 0x6E, 0x40, 0x54, 0x55, 0x43,
+    0x50, 0x5D, 0x46, 0x0C, 0x71, 0x16, 0x01, 0x00,
+    0x19, 0x05, 0x1B, 0x08, 0x05, 0x1E, 0x07, 0x71,
+    0x61, 0x07, 0x00, 0x64, 0x7A, 0x66, 0x78, 0x68,
+    0x76, 0x6A, 0x74, 0x6C, 0x79, 0x7A, 0x6F, 0x60,
+    0x17, 0x52
+};
+
+// Blob 4: 78 bytes (configs 8-9) - from xmmword_1800464D0..180046500 + int constants
+// Decrypts to: "48 8B C4 48 89 58 10 48 89 ? 18 55 57 41 57 48 8D 68 ? 48 81 EC ? ? ? ? 44 0F"
+static const unsigned char g_InputKeyBlob4[78] = {
+    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
+    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
+    0x7C, 0x65, 0x77, 0x77, 0x68, 0x7D, 0x72, 0x6B,
+    0x74, 0x74, 0x6E, 0x70, 0x70, 0x60, 0x6A, 0x73,
+    0x61, 0x60, 0x76, 0x62, 0x6F, 0x79, 0x6E, 0x6A,
+    0x7C, 0x68, 0x69, 0x7F, 0x54, 0x59, 0x42, 0x5B,
+    0x20, 0x45, 0x50, 0x0C, 0x15, 0x09, 0x17, 0x0C,
+    0x01, 0x1A, 0x03, 0x0D, 0x1D, 0x7B, 0x7C, 0x60,
+    0x7E, 0x62, 0x7C, 0x64, 0x7A, 0x66, 0x78, 0x68,
+    0x7D, 0x7E, 0x6B, 0x7C, 0x0B, 0x4E
+};
+
+namespace EncryptedBlobs {
+
+// Registry in BlobId order
+static const BlobInfo g_Registry[] = {
+    {BlobId::HookPatchTarget,    encrypted_pattern_64, sizeof(encrypted_pattern_64),
+        "Hook patch target (+23), 5914491 - 14786821"},
+    {BlobId::HookPatchSecondary, encrypted_pattern_45, sizeof(encrypted_pattern_45),
+        "Hook patch secondary (+6), 5914491 - 14786821"},
+    {BlobId::AdditionalHookFunc, encrypted_pattern_95, sizeof(encrypted_pattern_95),
+        "AdditionalHookFunc (qword_18004FDB8)"},
+    {BlobId::AdditionalAddr,     encrypted_pattern_84, sizeof(encrypted_pattern_84),
+        "AdditionalAddr (qword_18004FDD0)"},
+    {BlobId::InputKey1,          g_InputKeyBlob1,      sizeof(g_InputKeyBlob1),
+        "InputKey, config 1"},
+    {BlobId::InputKey2,          g_InputKeyBlob2,      sizeof(g_InputKeyBlob2),
+        "InputKey, configs 2-6"},
+    {BlobId::InputKey3,          g_InputKeyBlob3,      sizeof(g_InputKeyBlob3),
+        "InputKey, config 7"},
+    {BlobId::InputKey4,          g_InputKeyBlob4,      sizeof(g_InputKeyBlob4),
+        "InputKey, configs 8-9"},
+};
+
+static_assert(sizeof(g_Registry) / sizeof(g_Registry[0]) ==
+              static_cast<size_t>(BlobId::Count),
+              "every BlobId needs a registry entry");
+
+// Key period of the cipher; every blob starts on a multiple of this
+static constexpr int KEY_PERIOD = 51;
+
+static constexpr int BLOB_COUNT = static_cast<int>(BlobId::Count);
+
+static char* g_Arena = nullptr;
+static std::string_view g_Views[BLOB_COUNT];
+
+const BlobInfo& GetInfo(BlobId id)
+{
+    return g_Registry[static_cast<int>(id)];
+}
+
+bool DecryptAll()
+{
+    if (g_Arena)
+        return true;
+
+    // Lay out each blob at the next multiple of the key period
+    int offsets[BLOB_COUNT];
+    size_t arenaSize = 0;
+    for (int i = 0; i < BLOB_COUNT; ++i)
+    {
+        offsets[i] = static_cast<int>(arenaSize);
+        size_t padded = (g_Registry[i].length + KEY_PERIOD - 1) / KEY_PERIOD * KEY_PERIOD;
+        arenaSize += padded;
+    }
+
+    auto* arena = static_cast<char*>(
+        VirtualAlloc(nullptr, arenaSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+    if (!arena)
+    {
+        MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
+        return false;
+    }
+
+    for (int i = 0; i < BLOB_COUNT; ++i)
+        memcpy(arena + offsets[i], g_Registry[i].data, g_Registry[i].length);
+
+    // One pass over the whole arena; padding decrypts to garbage that is
+    // never referenced.
+    Hooks::DecryptPattern(arena, static_cast<int>(arenaSize));
+
+    // Each blob carries its own encrypted null terminator
+    for (int i = 0; i < BLOB_COUNT; ++i)
+    {
+        const char* text = arena + offsets[i];
+        g_Views[i] = std::string_view(text, strnlen(text, g_Registry[i].length));
+    }
+
+    DWORD oldProtect;
+    if (!VirtualProtect(arena, arenaSize, PAGE_READONLY, &oldProtect))
+    {
+        VirtualFree(arena, 0, MEM_RELEASE);
+        for (auto& view : g_Views)
+            view = std::string_view();
+        MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
+        return false;
+    }
+
+    g_Arena = arena;
+    return true;
+}
+
+std::string_view Get(BlobId id)
+{
+    return g_Views[static_cast<int>(id)];
+}
+
+} // namespace EncryptedBlobs
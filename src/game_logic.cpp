@@ -11,9 +11,10 @@
  *
  * Version handling:
  *   - 3700114 (v1.7.2): Patches a specific function to RET (0xC3)
- *   - 5914491-14801545: Applies byte patches via encrypted pattern scans
+ *   - 5914491-14786821: Applies byte patches via encrypted pattern scans
  *   - All versions: Resolves AdditionalHookFunc and AdditionalAddr,
  *                   then initializes SDK, console, and enters game loop
+ * The patches and address resolution all live in Hooks::ApplyHooks.
  *
  * The main game loop (sub_180025720) could not be decompiled by IDA
  * (function frame error) and is reconstructed as a stub. TODO: figure out wtf is going on
@@ -22,6 +23,11 @@
 #include "game_logic.h"
 #include "hooks.h"
 #include "ue4_sdk.h"
+#include "version_config.h"
+#include "telemetry.h"
+#include "name_cache.h"
+#include "object_index.h"
+#include "sdk_dump.h"
 
 namespace GameLogic {
 
@@ -37,7 +43,7 @@ namespace GameLogic {
 //        (Disables a specific function in the game for v1.7.2 compatibility)
 //
 //   2. if ((unsigned)(version - 5914491) <= 0x87618A):
-//        [Versions 5914491 to 14801545]
+//        [Versions 5914491 to 14786821]
 //        Decrypt 64-byte encrypted pattern (xmmword_1800461D0..180046200)
 //        Pattern scan in game module
 //        Store result address + 23 as patch target
@@ -62,39 +68,15 @@ namespace GameLogic {
 {
     int version = Globals::dword_18004FDE0;
 
-    // ========================================================================
-    // Step 1: Version 3700114 (v1.7.2) special handling
-    // Patches a specific function to return immediately (0xC3 = RET)
-    // Original: inline pattern scan with hardcoded string, VirtualProtect
-    // ========================================================================
-    if (version == 3700114)
-    {
-        HMODULE gameModule = GetModuleHandleW(nullptr);
-        uintptr_t addr = PatternScan::FindPattern(gameModule,
-            "48 89 5C 24 10 57 48 83 EC 60 49 8B F8 48 8B DA 4C");
-
-        if (addr)
-        {
-            DWORD oldProtect;
-            VirtualProtect(reinterpret_cast<void*>(addr), 1,
-                           PAGE_EXECUTE_READWRITE, &oldProtect);
-            *reinterpret_cast<uint8_t*>(addr) = 0xC3;
-            DWORD temp;
-            VirtualProtect(reinterpret_cast<void*>(addr), 1, oldProtect, &temp);
-        }
-        else
-        {
-            MessageBoxA(nullptr,
-                "Rift cannot start due to a pattern mismatch. "
-                "Please try another version.",
-                "Error", MB_ICONERROR);
-        }
-    }
+    // Join the pattern scans started by InitializePatterns; they have
+    // normally finished on the thread pool while GWorld was being polled
+    VersionManager::ResolveDeferredPatterns();
 
     // ========================================================================
-    // Steps 2 & 3: Apply version-specific hooks
-    // Hooks::ApplyHooks handles both:
-    //   - Version range byte patches (step 2)
+    // Steps 1-3: Apply version-specific hooks
+    // Hooks::ApplyHooks handles all of them:
+    //   - 3700114 RET stub (step 1) and version range byte patches (step 2),
+    //     both as HookPatch entries (built-in or from the signature database)
     //   - AdditionalHookFunc/AdditionalAddr resolution (step 3)
     // ========================================================================
     Hooks::ApplyHooks(version);
@@ -113,6 +95,23 @@ namespace GameLogic {
     // ========================================================================
     UE4::InitConsoleAndViewport();
 
+    // Reflection dump for mapping a new build, wanted when the rift_sdk
+    // folder exists next to the config
+    if (SdkDump::Requested())
+    {
+        SdkDump::Dump(SdkDump::DefaultDirectory());
+        SdkDump::PublishCounters();
+    }
+
+    // Every startup scan and the first GObjects sweeps have run by now;
+    // write out what they cost if asked to
+    if (Telemetry::DumpRequested())
+    {
+        NameCache::PublishCounters();
+        ObjectIndex::PublishCounters();
+        Telemetry::Dump(Telemetry::DefaultDumpPath());
+    }
+
     // ========================================================================
     // Step 6: Enter main game loop (never returns)
     // Original: sub_180025720
@@ -123,7 +122,9 @@ namespace GameLogic {
 // Original: sub_180025720
 // IDA decompilation failed with "function frame is wrong" error.
 // This is the core game interaction loop that:
-//   - Processes player input via InputKey (qword_18004FDA8)
+//   - Processes player input via InputKey (qword_18004FDA8; scanned in the
+//     background from ResolveDeferredPatterns, so a reconstruction reads it
+//     with GetPattern(PatternId::InputKey).Get(), which joins that scan)
 //   - Executes game commands via ProcessEvent
 //   - Manages game state (inventory, building, weapons, etc.)
 //   - Calls AdditionalHookFunc (qword_18004FDB8) for extended functionality
@@ -135,8 +136,14 @@ namespace GameLogic {
     // The original function enters an infinite processing loop that
     // handles game state and user interaction. Since IDA could not
     // produce pseudocode (frame error), this remains a stub.
+    //
+    // Each pass indexes new GObjects slots and re-checks a window of older
+    // ones for reuse, so the whole array is revisited every few minutes
     while (true)
+    {
+        ObjectIndex::Refresh();
         Sleep(1000);
+    }
 }
 
 } // namespace GameLogic
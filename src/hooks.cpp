@@ -6,82 +6,22 @@
  *
  * Original: Inline code in sub_1800282B0 (MainGameSetup)
  *
- * Encrypted pattern data extracted directly from Yosemite.dll .rdata section.
  * Decryption: XOR each byte with key[i] where key[i] = (i % 51) + 52
+ * The encrypted pattern data itself lives in encrypted_blobs.cpp and is
+ * decrypted once at startup by EncryptedBlobs::DecryptAll.
  */
 
 #include "hooks.h"
 #include "pattern_scan.h"
+#include "encrypted_blobs.h"
+#include "version_config.h"
+#include "signature_db.h"
+#include "lazy_pattern.h"
+#include "telemetry.h"
 #include <emmintrin.h>  // SSE2
 #include <smmintrin.h>  // SSE4.1
 #include <cstring>
 
-// ============================================================================
-// Encrypted pattern blobs from .rdata (extracted from binary)
-// These are XOR-encrypted with key (i % 51) + 52
-// ============================================================================
-
-// 64-byte encrypted pattern (xmmword_1800461D0..180046200)
-// Decrypts to: "48 8B C8 48 8B 47 30 48 39 14 C8 0F 85 ? ? ? ? 80 BE ? ? ? ? 03"
-// Used for versions: general (5914491 - 14801545 range)
-static unsigned char encrypted_pattern_64[64] = {
-    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x03,
-    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x03, 0x62, 0x77,
-    0x73, 0x65, 0x75, 0x77, 0x68, 0x7D, 0x72, 0x6B,
-    0x7F, 0x74, 0x6E, 0x7E, 0x64, 0x71, 0x11, 0x6B,
-    0x74, 0x65, 0x10, 0x77, 0x60, 0x6C, 0x7A, 0x64,
-    0x7C, 0x62, 0x7E, 0x60, 0x40, 0x5E, 0x42, 0x5B,
-    0x54, 0x45, 0x24, 0x71, 0x15, 0x09, 0x17, 0x07,
-    0x19, 0x05, 0x1B, 0x03, 0x1D, 0x0E, 0x0C, 0x40,
-};
-
-// 95-byte encrypted pattern (xmmword_180046990..1800469D0 + 15 bytes)
-// Decrypts to: "48 89 5C 24 ? 48 89 74 24 ? 57 48 83 EC ? 48 8B F1 41 8B D8 48 8B 0D ? ? ? ? 48 8B FA 48 85 C9"
-// Used for AdditionalHookFunc (qword_18004FDB8)
-static unsigned char encrypted_pattern_95[95] = {
-    0x00, 0x0D, 0x16, 0x0F, 0x01, 0x19, 0x0F, 0x78,
-    0x1C, 0x0F, 0x0A, 0x1F, 0x7F, 0x61, 0x76, 0x7B,
-    0x64, 0x7D, 0x7F, 0x67, 0x7F, 0x7D, 0x6A, 0x79,
-    0x78, 0x6D, 0x71, 0x6F, 0x65, 0x66, 0x72, 0x67,
-    0x6C, 0x75, 0x6E, 0x64, 0x78, 0x1C, 0x19, 0x7B,
-    0x63, 0x7D, 0x6A, 0x67, 0x40, 0x59, 0x20, 0x43,
-    0x22, 0x54, 0x46, 0x00, 0x04, 0x16, 0x0F, 0x7A,
-    0x19, 0x7E, 0x03, 0x1C, 0x09, 0x06, 0x1F, 0x78,
-    0x03, 0x62, 0x73, 0x00, 0x65, 0x79, 0x67, 0x77,
-    0x69, 0x75, 0x6B, 0x73, 0x6D, 0x7A, 0x77, 0x70,
-    0x69, 0x10, 0x73, 0x12, 0x14, 0x76, 0x63, 0x60,
-    0x79, 0x62, 0x6E, 0x7C, 0x1E, 0x67, 0x5F,
-};
-
-// 84-byte encrypted pattern (xmmword_180046AC0..180046B00 + 4 bytes)
-// Decrypts to: "48 8B C4 48 89 58 ? 48 89 70 ? 48 89 78 ? 55 48 8D 68 ? 48 81 EC ? ? ? ? 48 8B ? 7F"
-// Used for AdditionalAddr (qword_18004FDD0)
-static unsigned char encrypted_pattern_84[84] = {
-    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
-    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
-    0x7C, 0x65, 0x79, 0x67, 0x7C, 0x71, 0x6A, 0x73,
-    0x75, 0x6D, 0x79, 0x7F, 0x70, 0x6E, 0x72, 0x67,
-    0x6C, 0x75, 0x6E, 0x6E, 0x78, 0x6E, 0x62, 0x7B,
-    0x63, 0x7D, 0x6B, 0x6A, 0x40, 0x55, 0x5A, 0x43,
-    0x5C, 0x21, 0x46, 0x02, 0x0D, 0x16, 0x08, 0x18,
-    0x0D, 0x02, 0x1B, 0x04, 0x0C, 0x1E, 0x7A, 0x03,
-    0x61, 0x7D, 0x63, 0x7B, 0x65, 0x79, 0x67, 0x77,
-    0x69, 0x7E, 0x73, 0x6C, 0x75, 0x0C, 0x6F, 0x6F,
-    0x71, 0x65, 0x15, 0x54,
-};
-
-// 45-byte encrypted pattern (xmmword_180046FD0 + associated data)
-// Decrypts to: "80 BB ? ? ? ? 03 75 ? 8B 83 ? ? ? ? 48 8B CB"
-// Used for specific version range byte patching
-static unsigned char encrypted_pattern_45[45] = {
-    0x0C, 0x05, 0x16, 0x75, 0x7A, 0x19, 0x05, 0x1B,
-    0x03, 0x1D, 0x01, 0x1F, 0x7F, 0x61, 0x72, 0x70,
-    0x64, 0x72, 0x73, 0x67, 0x77, 0x69, 0x72, 0x09,
-    0x6C, 0x75, 0x7D, 0x6F, 0x6F, 0x71, 0x6D, 0x73,
-    0x6B, 0x75, 0x69, 0x77, 0x6C, 0x61, 0x7A, 0x63,
-    0x1E, 0x7D, 0x1D, 0x1D, 0x60,
-};
-
 namespace Hooks {
 
 // Decrypt an encrypted pattern string using XOR cipher.
@@ -92,92 +32,116 @@ namespace Hooks {
 //   - Computes i % 51 using multiplication by magic 0xA0A0A0A1
 //   - Packs result to bytes, adds 52, XORs with buffer
 //   - Scalar fallback for remaining bytes
-void DecryptPattern(char* buffer, int length)
+//
+// The two tiers are split out so tests/decrypt_tests.cpp can run each one
+// directly against the scalar reference.
+
+// Scalar tier from byte `start` onward; also handles the SIMD tail.
+static void DecryptScalarFrom(char* buffer, int start, int length)
+{
+    for (int i = start; i < length; ++i)
+        buffer[i] ^= static_cast<char>((i % 51) + 52);
+}
+
+// SSE4.1 tier body: decrypts whole 8-byte groups and returns the number
+// of bytes handled. The caller finishes the remainder with the scalar tier.
+static int DecryptBlocksSSE41(char* buffer, int length)
 {
     int i = 0;
 
-    // SSE2 vectorized path (when __isa_available >= 2, matching original)
-    if (Globals::dword_18004F028 >= 2)
-    {
-        __m128i indices_base = _mm_setr_epi32(0, 1, 2, 3);      // xmmword_180047BE0
-        __m128i divisor_magic = _mm_set1_epi32(0xA0A0A0A1u);    // xmmword_180047CD0
-        __m128i modulus = _mm_set1_epi32(51);                     // xmmword_180047C00
-        __m128i add_const;                                        // xmmword_180047C70
-        memset(&add_const, 0x34, sizeof(add_const));              // 0x34 = 52
-        __m128i mask = _mm_set1_epi16(0x00FF);                   // xmmword_180047C60
-        __m128i shift5 = _mm_cvtsi32_si128(5);
-        __m128i shift31 = _mm_cvtsi32_si128(31);
-        unsigned int addVal = 0x34343434u;  // cast for XOR
-
-        char* ptr = buffer + 4;
-
-        while (i + 8 <= length)
-        {
-            ptr += 8;
-
-            // First group of 4 indices
-            __m128i idx = _mm_add_epi32(
-                _mm_shuffle_epi32(_mm_cvtsi32_si128(i), 0),
-                indices_base);
-            __m128i idx2 = _mm_add_epi32(
-                _mm_shuffle_epi32(_mm_cvtsi32_si128(i + 4), 0),
-                indices_base);
-            i += 8;
-
-            // Compute idx % 51 using multiply-high trick
-            __m128i hi = (__m128i)_mm_shuffle_ps(
-                (__m128)_mm_mul_epi32(_mm_unpacklo_epi32(idx, idx), divisor_magic),
-                (__m128)_mm_mul_epi32(_mm_unpackhi_epi32(idx, idx), divisor_magic),
-                221);
-            __m128i q = _mm_sra_epi32(_mm_add_epi32(hi, idx), shift5);
-            q = _mm_add_epi32(_mm_srl_epi32(q, shift31), q);
-            __m128i rem = _mm_sub_epi32(idx, _mm_mullo_epi32(q, modulus));
-
-            // Pack remainder to bytes and add 52
-            __m128i packed = _mm_and_si128(
-                _mm_shuffle_epi32(
-                    _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(rem, 0xD8), 0xD8), 0xD8),
-                mask);
-            __m128i key = _mm_add_epi8(
-                _mm_packus_epi16(packed, packed),
-                _mm_cvtsi32_si128(addVal));
-
-            // XOR with buffer
-            *(reinterpret_cast<int*>(ptr - 12)) = _mm_cvtsi128_si32(
-                _mm_xor_si128(key,
-                    _mm_cvtsi32_si128(*(reinterpret_cast<int*>(ptr - 12)))));
-
-            // Second group
-            __m128i hi2 = (__m128i)_mm_shuffle_ps(
-                (__m128)_mm_mul_epi32(_mm_unpacklo_epi32(idx2, idx2), divisor_magic),
-                (__m128)_mm_mul_epi32(_mm_unpackhi_epi32(idx2, idx2), divisor_magic),
-                221);
-            __m128i q2 = _mm_sra_epi32(_mm_add_epi32(hi2, idx2), shift5);
-            q2 = _mm_add_epi32(_mm_srl_epi32(q2, shift31), q2);
-            __m128i rem2 = _mm_sub_epi32(idx2, _mm_mullo_epi32(q2, modulus));
-
-            __m128i packed2 = _mm_and_si128(
-                _mm_shuffle_epi32(
-                    _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(rem2, 0xD8), 0xD8), 0xD8),
-                mask);
-            __m128i key2 = _mm_add_epi8(
-                _mm_packus_epi16(packed2, packed2),
-                _mm_cvtsi32_si128(addVal));
-
-            *(reinterpret_cast<int*>(ptr - 8)) = _mm_cvtsi128_si32(
-                _mm_xor_si128(key2,
-                    _mm_cvtsi32_si128(*(reinterpret_cast<int*>(ptr - 8)))));
-        }
-    }
+    __m128i indices_base = _mm_setr_epi32(0, 1, 2, 3);      // xmmword_180047BE0
+    __m128i divisor_magic = _mm_set1_epi32(0xA0A0A0A1u);    // xmmword_180047CD0
+    __m128i modulus = _mm_set1_epi32(51);                     // xmmword_180047C00
+    __m128i add_const;                                        // xmmword_180047C70
+    memset(&add_const, 0x34, sizeof(add_const));              // 0x34 = 52
+    __m128i mask = _mm_set1_epi16(0x00FF);                   // xmmword_180047C60
+    __m128i shift5 = _mm_cvtsi32_si128(5);
+    __m128i shift31 = _mm_cvtsi32_si128(31);
+    unsigned int addVal = 0x34343434u;  // cast for XOR
 
-    // Scalar fallback for remaining bytes
-    while (i < length)
+    char* ptr = buffer + 4;
+
+    while (i + 8 <= length)
     {
-        buffer[i] ^= static_cast<char>((i % 51) + 52);
-        ++i;
+        ptr += 8;
+
+        // First group of 4 indices
+        __m128i idx = _mm_add_epi32(
+            _mm_shuffle_epi32(_mm_cvtsi32_si128(i), 0),
+            indices_base);
+        __m128i idx2 = _mm_add_epi32(
+            _mm_shuffle_epi32(_mm_cvtsi32_si128(i + 4), 0),
+            indices_base);
+        i += 8;
+
+        // Compute idx % 51 using multiply-high trick
+        __m128i hi = _mm_castps_si128(_mm_shuffle_ps(
+            _mm_castsi128_ps(_mm_mul_epi32(_mm_unpacklo_epi32(idx, idx), divisor_magic)),
+            _mm_castsi128_ps(_mm_mul_epi32(_mm_unpackhi_epi32(idx, idx), divisor_magic)),
+            221));
+        __m128i q = _mm_sra_epi32(_mm_add_epi32(hi, idx), shift5);
+        q = _mm_add_epi32(_mm_srl_epi32(q, shift31), q);
+        __m128i rem = _mm_sub_epi32(idx, _mm_mullo_epi32(q, modulus));
+
+        // Pack remainder to bytes and add 52
+        __m128i packed = _mm_and_si128(
+            _mm_shuffle_epi32(
+                _mm_shufflehi_epi16(
+                    _mm_shufflelo_epi16(rem, 0xD8), 0xD8), 0xD8),
+            mask);
+        __m128i key = _mm_add_epi8(
+            _mm_packus_epi16(packed, packed),
+            _mm_cvtsi32_si128(addVal));
+
+        // XOR with buffer
+        *(reinterpret_cast<int*>(ptr - 12)) = _mm_cvtsi128_si32(
+            _mm_xor_si128(key,
+                _mm_cvtsi32_si128(*(reinterpret_cast<int*>(ptr - 12)))));
+
+        // Second group
+        __m128i hi2 = _mm_castps_si128(_mm_shuffle_ps(
+            _mm_castsi128_ps(_mm_mul_epi32(_mm_unpacklo_epi32(idx2, idx2), divisor_magic)),
+            _mm_castsi128_ps(_mm_mul_epi32(_mm_unpackhi_epi32(idx2, idx2), divisor_magic)),
+            221));
+        __m128i q2 = _mm_sra_epi32(_mm_add_epi32(hi2, idx2), shift5);
+        q2 = _mm_add_epi32(_mm_srl_epi32(q2, shift31), q2);
+        __m128i rem2 = _mm_sub_epi32(idx2, _mm_mullo_epi32(q2, modulus));
+
+        __m128i packed2 = _mm_and_si128(
+            _mm_shuffle_epi32(
+                _mm_shufflehi_epi16(
+                    _mm_shufflelo_epi16(rem2, 0xD8), 0xD8), 0xD8),
+            mask);
+        __m128i key2 = _mm_add_epi8(
+            _mm_packus_epi16(packed2, packed2),
+            _mm_cvtsi32_si128(addVal));
+
+        *(reinterpret_cast<int*>(ptr - 8)) = _mm_cvtsi128_si32(
+            _mm_xor_si128(key2,
+                _mm_cvtsi32_si128(*(reinterpret_cast<int*>(ptr - 8)))));
     }
+
+    return i;
+}
+
+void DecryptPatternScalar(char* buffer, int length)
+{
+    DecryptScalarFrom(buffer, 0, length);
+}
+
+void DecryptPatternSSE41(char* buffer, int length)
+{
+    int done = DecryptBlocksSSE41(buffer, length);
+    DecryptScalarFrom(buffer, done, length);
+}
+
+void DecryptPattern(char* buffer, int length)
+{
+    // SSE vectorized path (when __isa_available >= 2, matching original)
+    if (Globals::dword_18004F028 >= 2)
+        DecryptPatternSSE41(buffer, length);
+    else
+        DecryptPatternScalar(buffer, length);
 }
 
 bool PatchByte(void* address, uint8_t value)
@@ -193,88 +157,229 @@ bool PatchByte(void* address, uint8_t value)
     return true;
 }
 
+// ============================================================================
+// Byte patches
+//
+// Every version-specific byte write is described by a HookPatch. The
+// built-in list below reproduces the original inline code; when a signature
+// database is loaded its patch records replace it.
+// ============================================================================
+struct HookPatch {
+    std::string_view name;               // for telemetry
+    unsigned char patchSet;              // PatchSet flag that enables it
+    PatternScan::PatternView pattern;
+    int offset;                          // from the match address
+    uint8_t value;
+    bool protect;                        // VirtualProtect around the write
+};
+
+static constexpr int kMaxHookPatches = 16;
+
+static void ReportPatternMismatch()
+{
+    MessageBoxA(nullptr,
+        "Rift cannot start due to a pattern mismatch. Please try another version.",
+        "Error", MB_ICONERROR);
+}
+
+// Built-in patches, compiled on first use
+static int BuiltinPatches(HookPatch* out)
+{
+    static PatternScan::CompiledPattern retStub, patchTarget, patchSecondary;
+    static bool compiled = false;
+    if (!compiled)
+    {
+        PatternScan::CompilePattern(
+            "48 89 5C 24 10 57 48 83 EC 60 49 8B F8 48 8B DA 4C", retStub);
+        PatternScan::CompilePattern(
+            EncryptedBlobs::Get(EncryptedBlobs::BlobId::HookPatchTarget), patchTarget);
+        PatternScan::CompilePattern(
+            EncryptedBlobs::Get(EncryptedBlobs::BlobId::HookPatchSecondary), patchSecondary);
+        compiled = true;
+    }
+
+    // 3700114 (v1.7.2): disable a function by patching its first byte to RET
+    out[0] = HookPatch{"RetStub", PATCH_RET_STUB, PatternScan::ViewOf(retStub), 0, 0xC3, true};
+    // 5914491 - 14786821: *(_BYTE*)(v40 + 23) = 2; v73[6] = 2;
+    out[1] = HookPatch{"HookPatchTarget", PATCH_BYTE_FLAGS, PatternScan::ViewOf(patchTarget), 23, 2, false};
+    out[2] = HookPatch{"HookPatchSecondary", PATCH_BYTE_FLAGS, PatternScan::ViewOf(patchSecondary), 6, 2, false};
+    return 3;
+}
+
+bool GetBuiltinPatch(int index, SignatureDB::PatchRecord& patch,
+                     SignatureDB::PatternRef& pattern)
+{
+    HookPatch patches[kMaxHookPatches];
+    if (index < 0 || index >= BuiltinPatches(patches))
+        return false;
+
+    const HookPatch& builtin = patches[index];
+    patch = SignatureDB::PatchRecord{0, builtin.offset, builtin.value, builtin.patchSet,
+                                     static_cast<uint8_t>(builtin.protect ? 1 : 0), 0};
+    pattern.name = builtin.name;
+    pattern.signatures[0] = SignatureDB::Signature{builtin.pattern, 0, 0};
+    pattern.count = 1;
+    return true;
+}
+
+static int CollectPatches(HookPatch* out)
+{
+    if (!SignatureDB::IsLoaded())
+        return BuiltinPatches(out);
+
+    int count = 0;
+    for (uint32_t i = 0; i < SignatureDB::PatchCount() && count < kMaxHookPatches; ++i)
+    {
+        SignatureDB::PatchRecord rec;
+        SignatureDB::PatternRef ref;
+        if (!SignatureDB::GetPatch(i, rec, ref))
+            continue;
+        out[count++] = HookPatch{ref.name, rec.patchSet, ref.signatures[0].pattern,
+                                 rec.offset, rec.value,
+                                 rec.protect != 0};
+    }
+    return count;
+}
+
+// ============================================================================
+// Always-resolved hook targets (qword_18004FDB8, qword_18004FDD0)
+//
+// Bound as lazy handles so they can be scanned in the background while
+// StartAddress waits for GWorld; ApplyHooks joins them.
+// ============================================================================
+static PatternScan::LazyPattern g_AdditionalHookFunc;
+static PatternScan::LazyPattern g_AdditionalAddr;
+
+// Signatures for one of the always-resolved addresses: from the active
+// database pattern set if it names it (alternatives included), otherwise
+// the embedded blob
+static SignatureDB::PatternRef AdditionalPattern(const VersionFeatures* features,
+                                                 const char* name,
+                                                 EncryptedBlobs::BlobId blob,
+                                                 PatternScan::CompiledPattern& storage)
+{
+    SignatureDB::PatternRef ref;
+    if (features && SignatureDB::FindPattern(features->patternSet, name, ref))
+        return ref;
+
+    PatternScan::CompilePattern(EncryptedBlobs::Get(blob), storage);
+    ref.name = name;
+    ref.signatures[0] = SignatureDB::Signature{PatternScan::ViewOf(storage), 0, 0};
+    ref.count = 1;
+    return ref;
+}
+
+// Scan and record telemetry for a hook pattern
+static uintptr_t ScanRecorded(HMODULE module, std::string_view name,
+                              const PatternScan::PatternView& pattern,
+                              int offset, const VersionFeatures* features)
+{
+    PatternScan::ScanStats stats;
+    uintptr_t addr = PatternScan::FindPatternCompiled(module, pattern, stats,
+                                                      Telemetry::ExhaustiveScans());
+    uintptr_t resolved = addr ? addr + offset : 0;
+    Telemetry::RecordScan(name, features ? features->patternSet : -1, stats,
+                          resolved, module);
+    return resolved;
+}
+
+// Hook targets are the raw match address of the winning signature
+static __int64 ScanHookTarget(const SignatureDB::PatternRef& ref,
+                              const VersionFeatures* features)
+{
+    PatternScan::PatternView views[PatternScan::kMaxAlternatives];
+    for (int i = 0; i < ref.count; ++i)
+        views[i] = ref.signatures[i].pattern;
+
+    HMODULE module = GetModuleHandleW(nullptr);
+    PatternScan::ScanStats stats;
+    uintptr_t addr;
+    PatternScan::FindFirstOfCompiled(module, views, ref.count, addr, stats,
+                                     Telemetry::ExhaustiveScans());
+    Telemetry::RecordScan(ref.name, features ? features->patternSet : -1, stats,
+                          addr, module);
+    if (!addr)
+        ReportPatternMismatch();
+    return static_cast<__int64>(addr);
+}
+
+static void BindHookTargets(int engineVersion)
+{
+    if (g_AdditionalHookFunc.IsBound())
+        return;
+
+    static PatternScan::CompiledPattern pattern95, pattern84;
+    const VersionFeatures* features = VersionManager::FindVersionFeatures(engineVersion);
+
+    // 95-byte pattern for AdditionalHookFunc
+    SignatureDB::PatternRef hookFunc = AdditionalPattern(features, "AdditionalHookFunc",
+        EncryptedBlobs::BlobId::AdditionalHookFunc, pattern95);
+    g_AdditionalHookFunc.Bind("AdditionalHookFunc", [hookFunc, features]() {
+        __int64 addr = ScanHookTarget(hookFunc, features);
+        Globals::qword_18004FDB8 =
+            reinterpret_cast<decltype(Globals::qword_18004FDB8)>(addr);
+        return addr;
+    });
+
+    // 84-byte pattern for AdditionalAddr
+    SignatureDB::PatternRef additionalAddr = AdditionalPattern(features, "AdditionalAddr",
+        EncryptedBlobs::BlobId::AdditionalAddr, pattern84);
+    g_AdditionalAddr.Bind("AdditionalAddr",
+        [additionalAddr, features]() { return ScanHookTarget(additionalAddr, features); },
+        &Globals::qword_18004FDD0);
+}
+
+void PrefetchHookTargets(int engineVersion)
+{
+    BindHookTargets(engineVersion);
+
+    PatternScan::LazyPattern* targets[] = { &g_AdditionalHookFunc, &g_AdditionalAddr };
+    PatternScan::LazyPattern::Prefetch(targets, 2);
+}
+
 // Apply version-specific hooks
 // Original: inline code in sub_1800282B0
 void ApplyHooks(int engineVersion)
 {
-    int isaAvailable = Globals::dword_18004F028;
     HMODULE gameModule = GetModuleHandleW(nullptr);
 
-    if (static_cast<unsigned int>(engineVersion - 5914491) <= 0x87618A)
+    const VersionFeatures* features = VersionManager::FindVersionFeatures(engineVersion);
+    unsigned char enabled = features ? features->patches : PATCH_NONE;
+
+    // Scan for every enabled patch first, then write, so a mismatch in a
+    // later pattern cannot leave the game half-patched by earlier ones
+    // (3700114: RET stub; 5914491 - 14786821: byte flags at +23 and +6)
+    HookPatch patches[kMaxHookPatches];
+    uintptr_t targets[kMaxHookPatches] = {};
+    int patchCount = enabled ? CollectPatches(patches) : 0;
+
+    for (int i = 0; i < patchCount; ++i)
     {
-        // Version range: 5914491 - 14801545
-        // Decrypt 64-byte pattern and scan
-        char pattern1[64];
-        memcpy(pattern1, encrypted_pattern_64, 64);
-        DecryptPattern(pattern1, 64);
-
-        uintptr_t addr1 = PatternScan::FindPatternRaw(gameModule,
-            PatternScan::ParsePattern(pattern1));
-        if (!addr1)
-        {
-            MessageBoxA(nullptr,
-                "Rift cannot start due to a pattern mismatch. Please try another version.",
-                "Error", MB_ICONERROR);
-        }
-
-        // Original: v43 = v40 + 23LL; v44 = (char*)v33 + v43
-        __int64 hookTarget = addr1 ? static_cast<__int64>(addr1) + 23 : 0;
-
-        // Decrypt 45-byte pattern
-        char pattern2[45];
-        memcpy(pattern2, encrypted_pattern_45, 45);
-        DecryptPattern(pattern2, 45);
-
-        uintptr_t addr2 = PatternScan::FindPatternRaw(gameModule,
-            PatternScan::ParsePattern(pattern2));
-        if (!addr2)
-        {
-            MessageBoxA(nullptr,
-                "Rift cannot start due to a pattern mismatch. Please try another version.",
-                "Error", MB_ICONERROR);
-            addr2 = 0;
-        }
-
-        // Byte patches: *(_BYTE*)v44 = 2; v73[6] = 2;
-        if (hookTarget)
-            *reinterpret_cast<unsigned char*>(hookTarget) = 2;
-        if (addr2)
-            reinterpret_cast<char*>(addr2)[6] = 2;
+        if (!(patches[i].patchSet & enabled))
+            continue;
+
+        targets[i] = ScanRecorded(gameModule, patches[i].name, patches[i].pattern,
+                                  patches[i].offset, features);
+        if (!targets[i])
+            ReportPatternMismatch();
     }
 
-    // All versions >= 14801546: decrypt 95-byte and 84-byte patterns
+    for (int i = 0; i < patchCount; ++i)
     {
-        // Decrypt 95-byte pattern for AdditionalHookFunc
-        char pattern95[95];
-        memcpy(pattern95, encrypted_pattern_95, 95);
-        DecryptPattern(pattern95, 95);
-
-        uintptr_t hookAddr = PatternScan::FindPatternRaw(gameModule,
-            PatternScan::ParsePattern(pattern95));
-        if (!hookAddr)
-        {
-            MessageBoxA(nullptr,
-                "Rift cannot start due to a pattern mismatch. Please try another version.",
-                "Error", MB_ICONERROR);
-        }
-        Globals::qword_18004FDB8 =
-            reinterpret_cast<decltype(Globals::qword_18004FDB8)>(hookAddr);
-
-        // Decrypt 84-byte pattern for AdditionalAddr
-        char pattern84[84];
-        memcpy(pattern84, encrypted_pattern_84, 84);
-        DecryptPattern(pattern84, 84);
-
-        uintptr_t addr84 = PatternScan::FindPatternRaw(gameModule,
-            PatternScan::ParsePattern(pattern84));
-        if (!addr84)
-        {
-            MessageBoxA(nullptr,
-                "Rift cannot start due to a pattern mismatch. Please try another version.",
-                "Error", MB_ICONERROR);
-        }
-        Globals::qword_18004FDD0 = addr84;
+        if (!targets[i])
+            continue;
+
+        if (patches[i].protect)
+            PatchByte(reinterpret_cast<void*>(targets[i]), patches[i].value);
+        else
+            *reinterpret_cast<uint8_t*>(targets[i]) = patches[i].value;
     }
+
+    // All versions: 95-byte and 84-byte patterns
+    // (usually already resolved by PrefetchHookTargets)
+    BindHookTargets(engineVersion);
+    g_AdditionalHookFunc.Get();
+    g_AdditionalAddr.Get();
 }
 
 } // namespace Hooks
@@ -0,0 +1,47 @@
+/*
+ * Rift DLL - Lazily Resolved Patterns
+ *
+ * Not present in the original binary, which scans every pattern up front in
+ * sub_180027620. Here only the patterns on the startup path are scanned
+ * eagerly; the rest are resolved on the startup thread pool while
+ * StartAddress waits for GWorld, or on first use, whichever comes first.
+ */
+
+#include "lazy_pattern.h"
+#include "thread_pool.h"
+
+namespace PatternScan {
+
+void LazyPattern::Bind(const char* name, Resolver resolver, __int64* publish)
+{
+    m_name = name;
+    m_resolver = std::move(resolver);
+    m_publish = publish;
+}
+
+__int64 LazyPattern::ResolveSlow()
+{
+    // call_once both runs the scan exactly once and blocks concurrent
+    // callers until it has finished
+    std::call_once(m_once, [this]() {
+        __int64 value = m_resolver ? m_resolver() : 0;
+        m_value = value;
+        if (m_publish)
+            InterlockedExchange64(reinterpret_cast<volatile LONG64*>(m_publish), value);
+        m_resolved.store(true, std::memory_order_release);
+    });
+    return m_value;
+}
+
+void LazyPattern::Prefetch(LazyPattern* const* handles, size_t count)
+{
+    // One pool task per handle so independent scans run side by side
+    for (size_t i = 0; i < count; ++i)
+    {
+        LazyPattern* handle = handles[i];
+        if (handle && handle->IsBound() && !handle->IsResolved())
+            ThreadPool::Enqueue([handle]() { handle->Get(); });
+    }
+}
+
+} // namespace PatternScan
@@ -0,0 +1,217 @@
+/*
+ * Rift DLL - FName Cache
+ *
+ * Not present in the original binary. Every object visited by
+ * StaticFindObject / FindPropertyOffset used to cost an engine
+ * FNameToString call plus a std::locale construction in WideToNarrow; with
+ * this cache a repeated sweep is one hash lookup per object.
+ */
+
+#include "name_cache.h"
+#include "telemetry.h"
+#include "string_utils.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NameCache {
+
+static constexpr size_t kShardCount = 16;
+
+// Rough per-entry cost on top of the name characters: the slot itself plus
+// one hash node
+static constexpr size_t kEntryOverhead = 64;
+
+struct Entry {
+    uint64_t key = 0;
+    Name name;
+    std::atomic<bool> referenced{false};    // CLOCK bit, set by readers
+    bool live = false;
+};
+
+// Slots live in a deque so they never move; the index maps a key to its slot
+struct Shard {
+    std::shared_mutex lock;
+    std::unordered_map<uint64_t, uint32_t> index;
+    std::deque<Entry> slots;
+    std::vector<uint32_t> freeSlots;
+    size_t hand = 0;
+    size_t bytes = 0;
+};
+
+static Shard g_Shards[kShardCount];
+static std::atomic<size_t> g_Capacity{kDefaultCapacity};
+static std::atomic<uint64_t> g_Hits{0};
+static std::atomic<uint64_t> g_Misses{0};
+static std::atomic<uint64_t> g_Evictions{0};
+
+static Shard& ShardFor(uint64_t fname)
+{
+    // Fibonacci hashing; the top bits select the shard
+    return g_Shards[(fname * 0x9E3779B97F4A7C15ull) >> 60];
+}
+
+static size_t EntryBytes(const Name& name)
+{
+    return kEntryOverhead + name->size();
+}
+
+// Evict with the CLOCK hand until `needed` more bytes fit in the shard's
+// budget. Caller holds the exclusive lock.
+static void MakeRoom(Shard& shard, size_t needed)
+{
+    size_t budget = g_Capacity.load(std::memory_order_relaxed) / kShardCount;
+    size_t live = shard.index.size();
+
+    // Each live entry is passed at most twice (clear bit, then evict)
+    size_t maxSteps = 2 * shard.slots.size();
+    for (size_t steps = 0; shard.bytes + needed > budget && live && steps < maxSteps; ++steps)
+    {
+        if (shard.hand >= shard.slots.size())
+            shard.hand = 0;
+
+        uint32_t slot = static_cast<uint32_t>(shard.hand++);
+        Entry& entry = shard.slots[slot];
+        if (!entry.live)
+            continue;
+        if (entry.referenced.exchange(false, std::memory_order_relaxed))
+            continue;
+
+        shard.bytes -= EntryBytes(entry.name);
+        shard.index.erase(entry.key);
+        entry.live = false;
+        entry.name.reset();
+        shard.freeSlots.push_back(slot);
+        --live;
+        g_Evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Insert `name` unless `fname` is already cached; returns the cached entry
+static Name InsertName(uint64_t fname, std::string name);
+
+Name Lookup(uint64_t fname, Resolver resolve)
+{
+    Shard& shard = ShardFor(fname);
+    {
+        std::shared_lock<std::shared_mutex> read(shard.lock);
+        auto found = shard.index.find(fname);
+        if (found != shard.index.end())
+        {
+            Entry& entry = shard.slots[found->second];
+            entry.referenced.store(true, std::memory_order_relaxed);
+            g_Hits.fetch_add(1, std::memory_order_relaxed);
+            return entry.name;
+        }
+    }
+
+    // Resolve outside the lock; two threads missing on the same name both
+    // call the engine and the first insert wins
+    g_Misses.fetch_add(1, std::memory_order_relaxed);
+    return InsertName(fname, resolve(fname));
+}
+
+Match Compare(uint64_t fname, std::string_view name)
+{
+    Shard& shard = ShardFor(fname);
+    std::shared_lock<std::shared_mutex> read(shard.lock);
+    auto found = shard.index.find(fname);
+    if (found == shard.index.end())
+    {
+        g_Misses.fetch_add(1, std::memory_order_relaxed);
+        return Match::Missing;
+    }
+
+    Entry& entry = shard.slots[found->second];
+    entry.referenced.store(true, std::memory_order_relaxed);
+    g_Hits.fetch_add(1, std::memory_order_relaxed);
+    return entry.name->size() == name.size() &&
+           StringUtils::BytesEqual(entry.name->data(), name.data(), name.size())
+        ? Match::Equal : Match::Different;
+}
+
+void Insert(uint64_t fname, std::string name)
+{
+    InsertName(fname, std::move(name));
+}
+
+static Name InsertName(uint64_t fname, std::string name)
+{
+    Shard& shard = ShardFor(fname);
+    std::unique_lock<std::shared_mutex> write(shard.lock);
+    auto found = shard.index.find(fname);
+    if (found != shard.index.end())
+        return shard.slots[found->second].name;
+
+    Name interned = std::make_shared<const std::string>(std::move(name));
+    size_t bytes = EntryBytes(interned);
+    MakeRoom(shard, bytes);
+
+    uint32_t slot;
+    if (!shard.freeSlots.empty())
+    {
+        slot = shard.freeSlots.back();
+        shard.freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(shard.slots.size());
+        shard.slots.emplace_back();
+    }
+
+    Entry& entry = shard.slots[slot];
+    entry.key = fname;
+    entry.name = interned;
+    entry.referenced.store(false, std::memory_order_relaxed);
+    entry.live = true;
+    shard.index.emplace(fname, slot);
+    shard.bytes += bytes;
+    return interned;
+}
+
+void SetCapacity(size_t bytes)
+{
+    g_Capacity.store(bytes, std::memory_order_relaxed);
+}
+
+void Clear()
+{
+    for (Shard& shard : g_Shards)
+    {
+        std::unique_lock<std::shared_mutex> write(shard.lock);
+        shard.index.clear();
+        shard.slots.clear();
+        shard.freeSlots.clear();
+        shard.hand = 0;
+        shard.bytes = 0;
+    }
+}
+
+Stats GetStats()
+{
+    Stats stats{g_Hits.load(std::memory_order_relaxed),
+                g_Misses.load(std::memory_order_relaxed),
+                g_Evictions.load(std::memory_order_relaxed), 0, 0};
+    for (Shard& shard : g_Shards)
+    {
+        std::shared_lock<std::shared_mutex> read(shard.lock);
+        stats.entries += shard.index.size();
+        stats.bytes += shard.bytes;
+    }
+    return stats;
+}
+
+void PublishCounters()
+{
+    Stats stats = GetStats();
+    Telemetry::SetCounter("nameCache.hits", stats.hits);
+    Telemetry::SetCounter("nameCache.misses", stats.misses);
+    Telemetry::SetCounter("nameCache.evictions", stats.evictions);
+    Telemetry::SetCounter("nameCache.entries", stats.entries);
+    Telemetry::SetCounter("nameCache.bytes", stats.bytes);
+}
+
+} // namespace NameCache
@@ -0,0 +1,446 @@
+/*
+ * Rift DLL - GObjects Name Index
+ *
+ * Not present in the original binary. sub_1800072D0 (StaticFindObject)
+ * and sub_180007790 (FindPropertyOffset) each walk the whole GObjects
+ * array; with the index built once they are hash lookups. Refresh()
+ * keeps it current as objects are created without another full sweep.
+ */
+
+#include "object_index.h"
+#include "ue4_sdk.h"
+#include "telemetry.h"
+#include "safe_memory.h"
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ObjectIndex {
+
+struct NameEntry {
+    __int64 object;     // first object in GObjects order
+    uint64_t fname;     // its raw FName, used to verify hits
+    int index;          // its GObjects slot
+};
+
+// (outer FName, FName) -> object
+struct OuterKey {
+    uint64_t outer;
+    uint64_t name;
+    bool operator==(const OuterKey& other) const
+    {
+        return outer == other.outer && name == other.name;
+    }
+};
+
+struct OuterKeyHash {
+    size_t operator()(const OuterKey& key) const
+    {
+        return static_cast<size_t>((key.outer * 0x9E3779B97F4A7C15ull) ^ key.name);
+    }
+};
+
+struct Maps {
+    std::unordered_map<std::string, NameEntry> byName;
+    std::unordered_map<OuterKey, NameEntry, OuterKeyHash> byOuter;
+    size_t nameBytes = 0;   // heap held by long name strings
+};
+
+// What a slot held when it was last indexed or re-checked
+struct SlotRecord {
+    __int64 object;
+    uint64_t fname;
+    uint64_t outerFName;
+    int serial;
+};
+
+// Keys a slot may own from before it was emptied or reused. The name is
+// resolved before g_Lock is taken.
+struct Stale {
+    int index;
+    uint64_t fname;
+    uint64_t outerFName;
+    std::string name;
+};
+
+// One object to index. Names are resolved before g_Lock is taken.
+struct Pending {
+    int index;
+    __int64 object;
+    uint64_t fname;
+    uint64_t outerFName;
+    std::string name;
+};
+
+static std::mutex g_BuildLock;      // one build or refresh at a time
+static std::shared_mutex g_Lock;    // guards the maps and stats
+static Maps g_Maps;
+static bool g_Built = false;
+static Stats g_Stats{};
+
+// Guarded by g_BuildLock
+static std::vector<SlotRecord> g_Slots;    // per slot below the watermark
+static int g_Watermark = 0;                // GObjects count when last indexed
+static int g_RecheckCursor = 0;            // next older slot to re-check
+
+// Rough cost of one hash node beyond its payload (next pointer, cached
+// hash, allocator header)
+static constexpr size_t kNodeOverhead = 32;
+
+template <typename Map>
+static size_t MapBytes(const Map& map)
+{
+    return map.bucket_count() * sizeof(void*) +
+           map.size() * (sizeof(typename Map::value_type) + kNodeOverhead);
+}
+
+static size_t IndexBytes()
+{
+    return MapBytes(g_Maps.byName) + MapBytes(g_Maps.byOuter) + g_Maps.nameBytes +
+           g_Slots.capacity() * sizeof(SlotRecord);
+}
+
+static uint64_t ElapsedNs(const LARGE_INTEGER& start)
+{
+    LARGE_INTEGER end, frequency;
+    QueryPerformanceCounter(&end);
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<uint64_t>(
+        (end.QuadPart - start.QuadPart) * 1000000000.0 / frequency.QuadPart);
+}
+
+// Objects are never moved, but a slot may have been reused since the build
+static bool StillNamed(__int64 obj, uint64_t fname)
+{
+    return SafeMemory::IsReadable(reinterpret_cast<const void*>(obj), 0x28) &&
+           UE4::GetObjectFName(obj) == fname;
+}
+
+static Pending Describe(int index, __int64 obj, uint64_t fname)
+{
+    __int64 outer = UE4::GetObjectOuter(obj);
+    return Pending{index, obj, fname, outer ? UE4::GetObjectFName(outer) : 0,
+                   UE4::GetObjectName(obj)};
+}
+
+// Drop the keys still pointing at a slot whose object is gone or replaced.
+// Another object carrying the same name is found by the caller's sweep
+// fallback, as before the index existed.
+static void Erase(Maps& maps, const Stale& stale)
+{
+    auto outer = maps.byOuter.find(OuterKey{stale.outerFName, stale.fname});
+    if (outer != maps.byOuter.end() && outer->second.index == stale.index)
+        maps.byOuter.erase(outer);
+
+    auto named = maps.byName.find(stale.name);
+    if (named != maps.byName.end() && named->second.index == stale.index)
+    {
+        if (named->first.capacity() > 15)
+            maps.nameBytes -= named->first.capacity() + 1;
+        maps.byName.erase(named);
+    }
+}
+
+static Stale Forget(int index, const SlotRecord& record)
+{
+    return Stale{index, record.fname, record.outerFName, *UE4::GetNameRef(record.fname)};
+}
+
+// A refreshed slot takes over a key from an entry further down GObjects
+// (what a linear sweep would now find first), from the previous occupant
+// of the same slot, or from an entry whose object is gone
+static bool Supersedes(const NameEntry& candidate, const NameEntry& current)
+{
+    return candidate.index <= current.index || !StillNamed(current.object, current.fname);
+}
+
+// During a build slots arrive in index order, so the first entry per key
+// is kept as is, matching the linear sweeps
+static void Insert(Maps& maps, Pending&& item, bool refreshing)
+{
+    NameEntry entry{item.object, item.fname, item.index};
+
+    auto outer = maps.byOuter.emplace(OuterKey{item.outerFName, item.fname}, entry);
+    if (!outer.second && refreshing && Supersedes(entry, outer.first->second))
+        outer.first->second = entry;
+
+    auto named = maps.byName.emplace(std::move(item.name), entry);
+    if (named.second)
+    {
+        if (named.first->first.capacity() > 15)
+            maps.nameBytes += named.first->first.capacity() + 1;
+    }
+    else if (refreshing && Supersedes(entry, named.first->second))
+    {
+        named.first->second = entry;
+    }
+}
+
+// Caller holds g_BuildLock
+static bool BuildLocked()
+{
+    UE4::ObjectTable table = UE4::ObjectTable::Capture();
+    if (table.count <= 0)
+        return false;
+    size_t count = static_cast<size_t>(table.count);
+
+    LARGE_INTEGER start;
+    QueryPerformanceCounter(&start);
+
+    Maps maps;
+    maps.byName.reserve(count);
+    maps.byOuter.reserve(count);
+    std::vector<SlotRecord> slots(count, SlotRecord{0, 0, 0, 0});
+
+    uint64_t objects = 0;
+    for (UE4::ObjectIterator it(table); it.Next();)
+    {
+        __int64 obj = it.Object();
+        uint64_t fname = UE4::GetObjectFName(obj);
+        ++objects;
+
+        Pending item = Describe(it.Index(), obj, fname);
+        slots[it.Index()] = SlotRecord{obj, fname, item.outerFName, it.Serial()};
+        Insert(maps, std::move(item), false);
+    }
+
+    uint64_t buildTimeNs = ElapsedNs(start);
+
+    std::unique_lock<std::shared_mutex> write(g_Lock);
+    std::swap(g_Maps, maps);
+    g_Slots.swap(slots);
+    g_Watermark = table.count;
+    g_RecheckCursor = 0;
+    g_Built = true;
+
+    g_Stats = Stats{};
+    g_Stats.objects = objects;
+    g_Stats.names = g_Maps.byName.size();
+    g_Stats.outerKeys = g_Maps.byOuter.size();
+    g_Stats.buildTimeNs = buildTimeNs;
+    g_Stats.bytes = IndexBytes();
+    g_Stats.watermark = static_cast<uint64_t>(g_Watermark);
+    return true;
+}
+
+bool Build()
+{
+    std::lock_guard<std::mutex> building(g_BuildLock);
+    return BuildLocked();
+}
+
+// Forget what an emptied or replaced slot held. Caller holds g_BuildLock.
+static void ClearSlot(int index, std::vector<Stale>& stale)
+{
+    SlotRecord& record = g_Slots[index];
+    if (record.object)
+        stale.push_back(Forget(index, record));
+    record = SlotRecord{0, 0, 0, 0};
+}
+
+// Re-check older slots [first, end): queue those now holding a different
+// object (or the same address renamed or with a new serial number) for
+// indexing, and the keys of those that were emptied or replaced for
+// removal. Caller holds g_BuildLock.
+static void RecheckRange(const UE4::ObjectTable& table, int first, int end,
+                         std::vector<Pending>& pending, std::vector<Stale>& stale)
+{
+    int expected = first;
+    for (UE4::ObjectIterator it(table, first); it.Next() && it.Index() < end;)
+    {
+        // The iterator skips empty slots
+        for (; expected < it.Index(); ++expected)
+            ClearSlot(expected, stale);
+        expected = it.Index() + 1;
+
+        __int64 obj = it.Object();
+        uint64_t fname = UE4::GetObjectFName(obj);
+        int serial = it.Serial();
+        SlotRecord& record = g_Slots[it.Index()];
+        if (record.object == obj && record.fname == fname && record.serial == serial)
+            continue;
+
+        ClearSlot(it.Index(), stale);
+        Pending item = Describe(it.Index(), obj, fname);
+        record = SlotRecord{obj, fname, item.outerFName, serial};
+        pending.push_back(std::move(item));
+    }
+
+    for (; expected < end; ++expected)
+        ClearSlot(expected, stale);
+}
+
+size_t Refresh(size_t recheckBudget)
+{
+    if (!IsBuilt())
+        return Build() ? static_cast<size_t>(GetStats().objects) : 0;
+
+    std::lock_guard<std::mutex> building(g_BuildLock);
+
+    UE4::ObjectTable table = UE4::ObjectTable::Capture();
+    if (table.count <= 0)
+        return 0;
+
+    // GObjects never shrinks; a smaller count means a different array
+    if (table.count < g_Watermark)
+        return BuildLocked() ? static_cast<size_t>(GetStats().objects) : 0;
+
+    LARGE_INTEGER start;
+    QueryPerformanceCounter(&start);
+
+    std::vector<Pending> pending;
+    std::vector<Stale> stale;
+    int watermark = g_Watermark;
+
+    // Round robin over the slots indexed so far
+    if (recheckBudget && watermark)
+    {
+        int budget = static_cast<int>(
+            recheckBudget < static_cast<size_t>(watermark) ? recheckBudget : watermark);
+        int first = g_RecheckCursor < watermark ? g_RecheckCursor : 0;
+        int end = first + budget;
+        if (end <= watermark)
+        {
+            RecheckRange(table, first, end, pending, stale);
+        }
+        else
+        {
+            RecheckRange(table, first, watermark, pending, stale);
+            end -= watermark;
+            RecheckRange(table, 0, end, pending, stale);
+        }
+        g_RecheckCursor = end < watermark ? end : 0;
+    }
+
+    // Slots added since the last build or refresh
+    if (table.count > watermark)
+    {
+        g_Slots.resize(static_cast<size_t>(table.count), SlotRecord{0, 0, 0, 0});
+        for (UE4::ObjectIterator it(table, watermark); it.Next();)
+        {
+            __int64 obj = it.Object();
+            uint64_t fname = UE4::GetObjectFName(obj);
+            Pending item = Describe(it.Index(), obj, fname);
+            g_Slots[it.Index()] = SlotRecord{obj, fname, item.outerFName, it.Serial()};
+            pending.push_back(std::move(item));
+        }
+        g_Watermark = table.count;
+    }
+
+    uint64_t refreshTimeNs = ElapsedNs(start);
+
+    // Removals first: a reused slot's new object may carry the same keys
+    std::unique_lock<std::shared_mutex> write(g_Lock);
+    for (const Stale& item : stale)
+        Erase(g_Maps, item);
+    for (Pending& item : pending)
+        Insert(g_Maps, std::move(item), true);
+
+    g_Stats.names = g_Maps.byName.size();
+    g_Stats.outerKeys = g_Maps.byOuter.size();
+    g_Stats.bytes = IndexBytes();
+    g_Stats.watermark = static_cast<uint64_t>(g_Watermark);
+    g_Stats.refreshes++;
+    g_Stats.reindexed += pending.size();
+    g_Stats.removed += stale.size();
+    g_Stats.refreshTimeNs = refreshTimeNs;
+    return pending.size();
+}
+
+void Reset()
+{
+    std::lock_guard<std::mutex> building(g_BuildLock);
+    std::unique_lock<std::shared_mutex> write(g_Lock);
+    g_Maps = Maps{};
+    g_Built = false;
+    g_Stats = Stats{};
+    std::vector<SlotRecord>().swap(g_Slots);
+    g_Watermark = 0;
+    g_RecheckCursor = 0;
+}
+
+bool IsBuilt()
+{
+    std::shared_lock<std::shared_mutex> read(g_Lock);
+    return g_Built;
+}
+
+static void EnsureBuilt()
+{
+    if (IsBuilt())
+        return;
+
+    // Build() serializes on g_BuildLock; a thread that waited there finds
+    // the index built and rebuilds it once more, which is harmless
+    Build();
+}
+
+static __int64 LookupName(std::string_view name)
+{
+    std::shared_lock<std::shared_mutex> read(g_Lock);
+    auto found = g_Maps.byName.find(std::string(name));
+    if (found == g_Maps.byName.end() || !StillNamed(found->second.object, found->second.fname))
+        return 0;
+    return found->second.object;
+}
+
+static __int64 LookupInOuter(std::string_view outerName, std::string_view name)
+{
+    std::shared_lock<std::shared_mutex> read(g_Lock);
+    auto outer = g_Maps.byName.find(std::string(outerName));
+    auto inner = g_Maps.byName.find(std::string(name));
+    if (outer == g_Maps.byName.end() || inner == g_Maps.byName.end())
+        return 0;
+
+    auto found = g_Maps.byOuter.find(OuterKey{outer->second.fname, inner->second.fname});
+    if (found == g_Maps.byOuter.end() || !StillNamed(found->second.object, found->second.fname))
+        return 0;
+    return found->second.object;
+}
+
+// A miss may be an object created after the last refresh; index new slots
+// only (no re-check) and look once more
+__int64 Find(std::string_view name)
+{
+    EnsureBuilt();
+
+    __int64 obj = LookupName(name);
+    if (!obj && Refresh(0))
+        obj = LookupName(name);
+    return obj;
+}
+
+__int64 FindInOuter(std::string_view outerName, std::string_view name)
+{
+    EnsureBuilt();
+
+    __int64 obj = LookupInOuter(outerName, name);
+    if (!obj && Refresh(0))
+        obj = LookupInOuter(outerName, name);
+    return obj;
+}
+
+Stats GetStats()
+{
+    std::shared_lock<std::shared_mutex> read(g_Lock);
+    return g_Stats;
+}
+
+void PublishCounters()
+{
+    Stats stats = GetStats();
+    Telemetry::SetCounter("objectIndex.objects", stats.objects);
+    Telemetry::SetCounter("objectIndex.names", stats.names);
+    Telemetry::SetCounter("objectIndex.outerKeys", stats.outerKeys);
+    Telemetry::SetCounter("objectIndex.buildTimeNs", stats.buildTimeNs);
+    Telemetry::SetCounter("objectIndex.bytes", stats.bytes);
+    Telemetry::SetCounter("objectIndex.watermark", stats.watermark);
+    Telemetry::SetCounter("objectIndex.refreshes", stats.refreshes);
+    Telemetry::SetCounter("objectIndex.reindexed", stats.reindexed);
+    Telemetry::SetCounter("objectIndex.removed", stats.removed);
+    Telemetry::SetCounter("objectIndex.refreshTimeNs", stats.refreshTimeNs);
+}
+
+} // namespace ObjectIndex
@@ -54,6 +54,227 @@ std::vector<int> ParsePattern(const char* pattern)
     return result;
 }
 
+// ============================================================================
+// Streaming pattern compiler
+// ============================================================================
+//
+// Tokenizer behind CompilePattern. Characters are fed one at a time and
+// each token is written into the byte/mask arrays as soon as its separator
+// is seen, so no intermediate string or vector is built. Token rules match
+// sub_180026F70: '?' / '??' is a wildcard, anything else is parsed as hex
+// up to the next separator.
+struct PatternCompiler {
+    CompiledPattern& out;
+    unsigned int value;
+    bool inToken;
+    bool wildcard;
+    bool overflow;
+
+    explicit PatternCompiler(CompiledPattern& target)
+        : out(target), value(0), inToken(false), wildcard(false), overflow(false)
+    {
+        out.size = 0;
+    }
+
+    void Emit()
+    {
+        if (!inToken)
+            return;
+
+        if (out.size < CompiledPattern::kMaxSize)
+        {
+            out.bytes[out.size] = wildcard ? 0 : static_cast<unsigned char>(value);
+            out.mask[out.size] = wildcard ? 0x00 : 0xFF;
+            ++out.size;
+        }
+        else
+        {
+            overflow = true;
+        }
+
+        value = 0;
+        inToken = false;
+        wildcard = false;
+    }
+
+    void Feed(char c)
+    {
+        if (c == '?')
+        {
+            wildcard = true;
+            inToken = true;
+        }
+        else if (c >= '0' && c <= '9')
+        {
+            value = (value << 4) | static_cast<unsigned int>(c - '0');
+            inToken = true;
+        }
+        else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+        {
+            value = (value << 4) | static_cast<unsigned int>((c | 0x20) - 'a' + 10);
+            inToken = true;
+        }
+        else
+        {
+            Emit();
+        }
+    }
+
+    bool Finish()
+    {
+        Emit();
+        return out.size > 0 && !overflow;
+    }
+};
+
+bool CompilePattern(std::string_view pattern, CompiledPattern& out)
+{
+    PatternCompiler compiler(out);
+    for (char c : pattern)
+    {
+        if (!c)
+            break;
+        compiler.Feed(c);
+    }
+    return compiler.Finish();
+}
+
+// Read SizeOfImage from the PE optional header
+// (matching original: v2 = *((int*)module + 15), then + v2 + 80)
+static unsigned __int64 GetImageSize(HMODULE module)
+{
+    __int64 e_lfanew = *reinterpret_cast<const int*>(
+        reinterpret_cast<const char*>(module) + 60);
+    return *reinterpret_cast<const unsigned int*>(
+        reinterpret_cast<const char*>(module) + e_lfanew + 80);
+}
+
+// Pattern scan over a compiled pattern.
+// Same scan range as FindPatternRaw ([0, sizeOfImage - patternSize)), but
+// each byte test is a single XOR/AND against the mask instead of a
+// wildcard branch on an int.
+uintptr_t FindPatternCompiled(HMODULE module, const PatternView& pattern)
+{
+    if (pattern.size <= 0)
+        return 0;
+
+    auto base = reinterpret_cast<const unsigned char*>(module);
+    unsigned __int64 sizeOfImage = GetImageSize(module);
+    unsigned __int64 patternSize = static_cast<unsigned __int64>(pattern.size);
+
+    if (sizeOfImage <= patternSize)
+        return 0;
+
+    unsigned __int64 scanRange = sizeOfImage - patternSize;
+
+    for (unsigned __int64 scanOffset = 0; scanOffset < scanRange; ++scanOffset)
+    {
+        const unsigned char* p = base + scanOffset;
+        int j = 0;
+        while (j < pattern.size && !((p[j] ^ pattern.bytes[j]) & pattern.mask[j]))
+            ++j;
+        if (j == pattern.size)
+            return reinterpret_cast<uintptr_t>(p);
+    }
+
+    return 0;
+}
+
+// Instrumented variant of the scan above: a one-signature FindFirstOf
+uintptr_t FindPatternCompiled(HMODULE module, const PatternView& pattern,
+                              ScanStats& stats, bool exhaustive)
+{
+    uintptr_t address;
+    FindFirstOfCompiled(module, &pattern, 1, address, stats, exhaustive);
+    return address;
+}
+
+int FindFirstOfCompiled(HMODULE module, const PatternView* patterns, int count,
+                        uintptr_t& address, ScanStats& stats, bool exhaustive)
+{
+    stats = ScanStats{ScanTier::Scalar, exhaustive, 0, 0, 0, 0, -1};
+    address = 0;
+    if (count <= 0 || count > kMaxAlternatives)
+        return -1;
+
+    LARGE_INTEGER start, end, frequency;
+    QueryPerformanceCounter(&start);
+
+    auto base = reinterpret_cast<const unsigned char*>(module);
+    unsigned __int64 sizeOfImage = GetImageSize(module);
+
+    // Each signature keeps the single-pattern scan range [0, size - len).
+    // Its anchor is the first literal byte: only offsets where that byte
+    // matches count as candidates (leading wildcards match everywhere).
+    unsigned __int64 ranges[kMaxAlternatives] = {};
+    int anchors[kMaxAlternatives] = {};
+    unsigned __int64 sweep = 0;
+    for (int k = 0; k < count; ++k)
+    {
+        unsigned __int64 len = static_cast<unsigned __int64>(patterns[k].size);
+        if (patterns[k].size > 0 && sizeOfImage > len)
+            ranges[k] = sizeOfImage - len;
+        if (ranges[k] > sweep)
+            sweep = ranges[k];
+
+        while (anchors[k] < patterns[k].size && !patterns[k].mask[anchors[k]])
+            ++anchors[k];
+        if (anchors[k] == patterns[k].size)
+            anchors[k] = 0;
+    }
+
+    uint32_t matches[kMaxAlternatives] = {};
+    uintptr_t first[kMaxAlternatives] = {};
+    int active = count;     // only signatures [0, active) can still win
+    int best = -1;
+    unsigned __int64 scanOffset = 0;
+
+    for (; scanOffset < sweep && active > 0; ++scanOffset)
+    {
+        const unsigned char* p = base + scanOffset;
+        for (int k = 0; k < active; ++k)
+        {
+            if (scanOffset >= ranges[k])
+                continue;
+
+            const PatternView& pattern = patterns[k];
+            int j = 0;
+            while (j < pattern.size && !((p[j] ^ pattern.bytes[j]) & pattern.mask[j]))
+                ++j;
+            if (j > anchors[k])
+                ++stats.candidatesTested;
+            if (j != pattern.size)
+                continue;
+
+            ++matches[k];
+            if (!first[k])
+                first[k] = reinterpret_cast<uintptr_t>(p);
+            if (best < 0 || k < best)
+                best = k;
+            if (!exhaustive)
+            {
+                // Lower-priority signatures can no longer win
+                active = k;
+                break;
+            }
+        }
+    }
+    stats.bytesScanned = scanOffset;
+
+    if (best >= 0)
+    {
+        address = first[best];
+        stats.matchCount = matches[best];
+        stats.alternative = best;
+    }
+
+    QueryPerformanceCounter(&end);
+    QueryPerformanceFrequency(&frequency);
+    stats.wallTimeNs = static_cast<uint64_t>(
+        (end.QuadPart - start.QuadPart) * 1000000000.0 / frequency.QuadPart);
+    return best;
+}
+
 // Pattern scan: linear scan through module memory
 // Matches the exact loop structure from StartAddress and sub_180027620:
 //   for each offset in [0, sizeOfImage - patternSize):
@@ -68,13 +289,7 @@ uintptr_t FindPatternRaw(HMODULE module, const std::vector<int>& pattern)
         return 0;
 
     auto base = reinterpret_cast<const unsigned char*>(module);
-
-    // Read SizeOfImage from PE header (matching original: v2 = *((int*)module + 15))
-    // ((int*)module + 15) = offset 60 = e_lfanew
-    __int64 e_lfanew = *reinterpret_cast<const int*>(
-        reinterpret_cast<const char*>(module) + 60);
-    unsigned __int64 sizeOfImage = *reinterpret_cast<const unsigned int*>(
-        reinterpret_cast<const char*>(module) + e_lfanew + 80);
+    unsigned __int64 sizeOfImage = GetImageSize(module);
 
     unsigned __int64 patternSize = pattern.size();
     unsigned __int64 scanRange = sizeOfImage - patternSize;
@@ -117,8 +332,11 @@ found:
 uintptr_t FindPattern(HMODULE module, const char* patternStr,
                       int offset_a, int offset_b)
 {
-    auto pattern = ParsePattern(patternStr);
-    uintptr_t addr = FindPatternRaw(module, pattern);
+    CompiledPattern pattern;
+    if (!CompilePattern(patternStr, pattern))
+        return 0;
+
+    uintptr_t addr = FindPatternCompiled(module, pattern);
 
     if (!addr)
         return 0;
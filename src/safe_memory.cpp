@@ -0,0 +1,150 @@
+/*
+ * Rift DLL - Fault-Safe Memory Reads
+ *
+ * Not present in the original binary, which guards its property chain
+ * walks (sub_180006CA0) and GObjects checks with IsBadReadPtr. Those walks
+ * now check a cached region snapshot and make no system call per node.
+ */
+
+#include "safe_memory.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace SafeMemory {
+
+// [begin, end) of readable memory; adjacent regions are merged
+struct Region {
+    uintptr_t begin;
+    uintptr_t end;
+};
+
+static std::shared_mutex g_Lock;          // guards g_Regions
+static std::vector<Region> g_Regions;     // sorted by begin
+static std::mutex g_RefreshLock;          // one refresh at a time
+static std::atomic<long long> g_LastRefreshMs{-1};
+static std::atomic<bool> g_Stale{true};   // no snapshot yet, or a read faulted
+
+static constexpr DWORD kReadableProtect =
+    PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY |
+    PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+
+static long long NowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool IsReadableRegion(const MEMORY_BASIC_INFORMATION& info)
+{
+    return info.State == MEM_COMMIT && (info.Protect & kReadableProtect) &&
+           !(info.Protect & (PAGE_GUARD | PAGE_NOACCESS));
+}
+
+void Refresh()
+{
+    std::lock_guard<std::mutex> refreshing(g_RefreshLock);
+
+    SYSTEM_INFO system;
+    GetSystemInfo(&system);
+    auto address = reinterpret_cast<uintptr_t>(system.lpMinimumApplicationAddress);
+    auto last = reinterpret_cast<uintptr_t>(system.lpMaximumApplicationAddress);
+
+    std::vector<Region> regions;
+    MEMORY_BASIC_INFORMATION info;
+    while (address < last &&
+           VirtualQuery(reinterpret_cast<LPCVOID>(address), &info, sizeof(info)) == sizeof(info))
+    {
+        auto begin = reinterpret_cast<uintptr_t>(info.BaseAddress);
+        uintptr_t end = begin + info.RegionSize;
+        if (end <= address)
+            break;
+
+        if (IsReadableRegion(info))
+        {
+            if (!regions.empty() && regions.back().end == begin)
+                regions.back().end = end;
+            else
+                regions.push_back(Region{begin, end});
+        }
+        address = end;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> write(g_Lock);
+        g_Regions.swap(regions);
+    }
+    g_LastRefreshMs.store(NowMs());
+    g_Stale.store(false);
+}
+
+static bool RefreshDue()
+{
+    long long last = g_LastRefreshMs.load(std::memory_order_relaxed);
+    return last < 0 || NowMs() - last >= kMinRefreshMs;
+}
+
+static bool InSnapshot(uintptr_t begin, uintptr_t end)
+{
+    std::shared_lock<std::shared_mutex> read(g_Lock);
+    auto next = std::upper_bound(g_Regions.begin(), g_Regions.end(), begin,
+        [](uintptr_t address, const Region& region) { return address < region.begin; });
+    if (next == g_Regions.begin())
+        return false;
+    const Region& region = *(next - 1);
+    return end <= region.end;
+}
+
+bool IsReadable(const void* address, size_t size)
+{
+    auto begin = reinterpret_cast<uintptr_t>(address);
+    uintptr_t end = begin + (size ? size : 1);
+    if (!begin || end < begin)
+        return false;
+
+    if (g_Stale.load(std::memory_order_relaxed) && RefreshDue())
+        Refresh();
+    if (InSnapshot(begin, end))
+        return true;
+
+    // A miss may be memory allocated since the snapshot; between refreshes
+    // it is reported unreadable rather than probed
+    if (!RefreshDue())
+        return false;
+    Refresh();
+    return InSnapshot(begin, end);
+}
+
+// No C++ objects with destructors in here, so MSVC allows __try
+static bool GuardedCopy(void* out, const void* address, size_t size)
+{
+    __try
+    {
+        std::memcpy(out, address, size);
+        return true;
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        return false;
+    }
+}
+
+bool Read(const void* address, void* out, size_t size)
+{
+    if (!IsReadable(address, size))
+        return false;
+
+    // The snapshot said readable but the memory is gone: it's out of date
+    if (!GuardedCopy(out, address, size))
+    {
+        g_Stale.store(true);
+        return false;
+    }
+    return true;
+}
+
+} // namespace SafeMemory
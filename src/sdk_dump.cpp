@@ -0,0 +1,981 @@
+/*
+ * Rift DLL - SDK Dump
+ *
+ * Not present in the original binary. Walks the reflection data behind
+ * GObjects and writes it out as C++ headers plus a JSON file, so the
+ * offsets of a new build come from the game instead of from hand mapping.
+ *
+ * A dump runs in four passes:
+ *   1. collect  - classify every GObjects slot by the name of its class
+ *                 (and, on object sweep layouts, group UProperty objects
+ *                 by Outer)                                     [parallel]
+ *   2. read     - name, package, super, size, properties, enum values
+ *                 of each collected type                        [parallel]
+ *   3. link     - resolve supers to types, pick unique C++ names, order
+ *                 each package so supers come first             [serial]
+ *   4. format   - header and JSON text of each type             [parallel]
+ * after which every package header and reflection.json is written through
+ * a 1 MiB buffer.
+ */
+
+#include "sdk_dump.h"
+#include "ue4_sdk.h"
+#include "config.h"
+#include "telemetry.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace SdkDump {
+
+// Work items per block handed to a thread
+static constexpr int COLLECT_BLOCK = 8192;    // GObjects slots
+static constexpr size_t TYPE_BLOCK = 256;     // types to read or format
+static constexpr size_t PACKAGE_BLOCK = 16;   // headers to write
+
+// PropertiesSize above this is treated as garbage
+static constexpr int MAX_STRUCT_SIZE = 0x1000000;
+
+// Super chains longer than this are treated as cycles
+static constexpr int MAX_SUPER_DEPTH = 256;
+
+// EPropertyFlags::CPF_Parm: a function property that is a parameter rather
+// than a local
+static constexpr uint64_t CPF_PARM = 0x80;
+
+// ============================================================================
+// Type classification
+// ============================================================================
+
+enum class Kind : unsigned char {
+    None,
+    Class,
+    Struct,
+    Enum,
+    Function,
+    Property,   // UProperty object (object sweep layouts only)
+};
+
+struct MetaClass {
+    const char* name;
+    Kind kind;
+};
+
+// Classes whose instances are reflected types
+static const MetaClass g_MetaClasses[] = {
+    {"Class",                         Kind::Class},
+    {"BlueprintGeneratedClass",       Kind::Class},
+    {"WidgetBlueprintGeneratedClass", Kind::Class},
+    {"AnimBlueprintGeneratedClass",   Kind::Class},
+    {"ScriptStruct",                  Kind::Struct},
+    {"UserDefinedStruct",             Kind::Struct},
+    {"Enum",                          Kind::Enum},
+    {"UserDefinedEnum",               Kind::Enum},
+    {"Function",                      Kind::Function},
+    {"DelegateFunction",              Kind::Function},
+    {"SparseDelegateFunction",        Kind::Function},
+};
+
+static Kind Classify(__int64 obj, bool propertyObjects)
+{
+    NameCache::Name metaRef = UE4::GetObjectNameRef(UE4::GetObjectClass(obj));
+    const std::string& meta = *metaRef;
+    for (const MetaClass& entry : g_MetaClasses)
+    {
+        if (meta == entry.name)
+            return entry.kind;
+    }
+
+    static constexpr size_t kSuffix = sizeof("Property") - 1;
+    if (propertyObjects && meta.size() > kSuffix &&
+        meta.compare(meta.size() - kSuffix, kSuffix, "Property") == 0)
+    {
+        return Kind::Property;
+    }
+    return Kind::None;
+}
+
+static const char* KindName(Kind kind)
+{
+    switch (kind)
+    {
+    case Kind::Class: return "class";
+    case Kind::Struct: return "struct";
+    case Kind::Enum: return "enum";
+    case Kind::Function: return "function";
+    default: return "unknown";
+    }
+}
+
+// ============================================================================
+// Parallel blocks
+// ============================================================================
+//
+// Blocks are claimed in order from a shared counter by the calling thread
+// and ThreadPool::HelperCount pool tasks, as in ParallelSweep. Each block
+// writes only its own output slots, so results come out in block order
+// without locking.
+
+template <typename F>
+static void ForEachBlock(size_t blocks, const F& run)
+{
+    if (!blocks)
+        return;
+
+    std::atomic<size_t> next{0};
+    auto worker = [&next, &run, blocks]() {
+        for (size_t block; (block = next.fetch_add(1)) < blocks;)
+            run(block);
+    };
+
+    unsigned helpers = ThreadPool::HelperCount(blocks);
+    std::vector<std::future<void>> pending;
+    for (unsigned i = 0; i < helpers; ++i)
+        pending.push_back(ThreadPool::Submit(worker));
+    worker();
+    for (auto& task : pending)
+        task.get();
+}
+
+// ============================================================================
+// Collected data
+// ============================================================================
+
+struct Type {
+    Kind kind;
+    __int64 object;
+
+    // read pass
+    std::string name;
+    std::string package;
+    __int64 outer;                 // functions: owning class
+    __int64 superObject;
+    int size;
+    std::vector<UE4::PropertyInfo> properties;
+    std::vector<std::pair<std::string, int64_t>> values;   // enums
+
+    // link pass
+    int super = -1;                // index into the type list
+    int owner = -1;                // functions: owning class
+    int packageIndex = -1;
+    std::string cppName;
+
+    // format pass
+    std::string header;
+    std::string json;
+};
+
+struct Package {
+    std::string name;              // file name without extension
+    std::vector<int> types;        // output order
+    std::vector<int> includes;     // packages holding supers
+};
+
+static std::mutex g_StatsLock;
+static Stats g_Stats{};
+
+static uint64_t ElapsedNs(const LARGE_INTEGER& start)
+{
+    LARGE_INTEGER end, frequency;
+    QueryPerformanceCounter(&end);
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<uint64_t>(
+        (end.QuadPart - start.QuadPart) * 1000000000.0 / frequency.QuadPart);
+}
+
+// Formats straight onto the end of `out`, however long the result
+static void Appendf(std::string& out, const char* format, ...)
+{
+    va_list args, measure;
+    va_start(args, format);
+    va_copy(measure, args);
+    int len = vsnprintf(nullptr, 0, format, measure);
+    va_end(measure);
+    if (len > 0)
+    {
+        size_t at = out.size();
+        out.resize(at + static_cast<size_t>(len) + 1);
+        vsnprintf(&out[at], static_cast<size_t>(len) + 1, format, args);
+        out.resize(at + static_cast<size_t>(len));
+    }
+    va_end(args);
+}
+
+// Letters, digits and '_' only, not starting with a digit
+static std::string Identifier(const std::string& text)
+{
+    std::string out = text;
+    for (char& c : out)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+            c = '_';
+    }
+    if (out.empty() || std::isdigit(static_cast<unsigned char>(out[0])))
+        out.insert(out.begin(), '_');
+    return out;
+}
+
+static const std::unordered_set<std::string>& Keywords()
+{
+    static const std::unordered_set<std::string> keywords = {
+        "auto", "bool", "break", "case", "catch", "char", "class", "const",
+        "continue", "default", "delete", "do", "double", "else", "enum",
+        "explicit", "export", "extern", "false", "float", "for", "friend",
+        "goto", "if", "inline", "int", "long", "mutable", "namespace", "new",
+        "operator", "private", "protected", "public", "register", "return",
+        "short", "signed", "sizeof", "static", "struct", "switch", "template",
+        "this", "throw", "true", "try", "typedef", "typename", "union",
+        "unsigned", "using", "virtual", "void", "volatile", "while",
+    };
+    return keywords;
+}
+
+// Identifier(text), made distinct from everything already in `used`
+static std::string UniqueIdentifier(const std::string& text,
+                                    std::unordered_set<std::string>& used)
+{
+    std::string base = Identifier(text);
+    if (Keywords().count(base))
+        base += '_';
+
+    std::string name = base;
+    for (int n = 1; !used.insert(name).second; ++n)
+        name = base + "_" + std::to_string(n);
+    return name;
+}
+
+// Last path element of the outermost object, e.g. "/Script/Engine" -> "Engine"
+static std::string PackageName(__int64 obj)
+{
+    __int64 outermost = obj;
+    for (__int64 outer = UE4::GetObjectOuter(obj); outer; outer = UE4::GetObjectOuter(outer))
+        outermost = outer;
+
+    std::string name = UE4::GetObjectName(outermost);
+    size_t slash = name.rfind('/');
+    return slash == std::string::npos ? name : name.substr(slash + 1);
+}
+
+static int PropertyEnd(const UE4::PropertyInfo& prop)
+{
+    return prop.offset + prop.elementSize * prop.arrayDim;
+}
+
+// ============================================================================
+// Pass 1: collect
+// ============================================================================
+
+struct Collected {
+    std::vector<Type> types;
+    std::unordered_map<__int64, std::vector<__int64>> children;   // Outer -> UProperty objects
+};
+
+static void Collect(const UE4::ObjectTable& table, bool propertyObjects, Collected& out)
+{
+    struct Block {
+        std::vector<std::pair<Kind, __int64>> types;
+        std::vector<std::pair<__int64, __int64>> properties;   // (outer, property)
+    };
+
+    size_t blockCount = (static_cast<size_t>(table.count) + COLLECT_BLOCK - 1) / COLLECT_BLOCK;
+    std::vector<Block> blocks(blockCount);
+
+    ForEachBlock(blockCount, [&table, &blocks, propertyObjects](size_t b) {
+        Block& block = blocks[b];
+        int first = static_cast<int>(b) * COLLECT_BLOCK;
+        int end = first + COLLECT_BLOCK < table.count ? first + COLLECT_BLOCK : table.count;
+        for (UE4::ObjectIterator it(table, first); it.Next() && it.Index() < end;)
+        {
+            Kind kind = Classify(it.Object(), propertyObjects);
+            if (kind == Kind::Property)
+                block.properties.emplace_back(UE4::GetObjectOuter(it.Object()), it.Object());
+            else if (kind != Kind::None)
+                block.types.emplace_back(kind, it.Object());
+        }
+    });
+
+    // GObjects order is declaration order, which the blocks preserve
+    for (Block& block : blocks)
+    {
+        for (const auto& entry : block.types)
+        {
+            Type type{};
+            type.kind = entry.first;
+            type.object = entry.second;
+            out.types.push_back(std::move(type));
+        }
+        for (const auto& entry : block.properties)
+            out.children[entry.first].push_back(entry.second);
+    }
+}
+
+// ============================================================================
+// Pass 2: read
+// ============================================================================
+
+static void ReadType(Type& type, const Collected& collected, bool chain)
+{
+    type.name = UE4::GetObjectName(type.object);
+    type.package = PackageName(type.object);
+
+    if (type.kind == Kind::Enum)
+    {
+        UE4::ReadEnumNames(type.object, type.values);
+        return;
+    }
+
+    if (chain)
+    {
+        UE4::ReadPropertyChain(type.object, type.properties);
+    }
+    else
+    {
+        auto found = collected.children.find(type.object);
+        if (found != collected.children.end())
+        {
+            for (__int64 prop : found->second)
+                type.properties.push_back(UE4::ReadPropertyObject(prop));
+        }
+    }
+
+    if (type.kind == Kind::Function)
+    {
+        type.outer = UE4::GetObjectOuter(type.object);
+        // Only the parameters make up the struct ProcessEvent is handed
+        int end = 0;
+        for (const UE4::PropertyInfo& prop : type.properties)
+        {
+            if ((prop.flags & CPF_PARM) && PropertyEnd(prop) > end)
+                end = PropertyEnd(prop);
+        }
+        type.size = (end + 7) & ~7;
+        return;
+    }
+
+    UE4::StructLayout layout = UE4::ReadStructLayout(type.object);
+    type.superObject = layout.super;
+    type.size = layout.size;
+
+    // A PropertiesSize that doesn't cover the properties wasn't read from
+    // where this build keeps it
+    int end = 0;
+    for (const UE4::PropertyInfo& prop : type.properties)
+        end = std::max(end, PropertyEnd(prop));
+    if (type.size < end || type.size > MAX_STRUCT_SIZE)
+        type.size = end;
+}
+
+// ============================================================================
+// Pass 3: link
+// ============================================================================
+
+static bool IsActor(const std::vector<Type>& types, int index)
+{
+    for (int depth = 0; index >= 0 && depth < MAX_SUPER_DEPTH; ++depth)
+    {
+        const Type& type = types[index];
+        if (type.name == "Actor" && type.package == "Engine")
+            return true;
+        index = type.super;
+    }
+    return false;
+}
+
+// Append `index` to its package after the supers that share the package
+static void Order(std::vector<Type>& types, std::vector<Package>& packages,
+                  std::vector<unsigned char>& placed, int index)
+{
+    int chain[MAX_SUPER_DEPTH];
+    int depth = 0;
+    for (int i = index; i >= 0 && !placed[i] && depth < MAX_SUPER_DEPTH; i = types[i].super)
+    {
+        if (types[i].packageIndex != types[index].packageIndex)
+            break;
+        placed[i] = 1;
+        chain[depth++] = i;
+    }
+    while (depth--)
+        packages[types[chain[depth]].packageIndex].types.push_back(chain[depth]);
+}
+
+static void Link(std::vector<Type>& types, std::vector<Package>& packages)
+{
+    std::unordered_map<__int64, int> byObject;
+    byObject.reserve(types.size());
+    for (size_t i = 0; i < types.size(); ++i)
+        byObject.emplace(types[i].object, static_cast<int>(i));
+
+    for (Type& type : types)
+    {
+        if (type.kind == Kind::Function)
+        {
+            auto found = byObject.find(type.outer);
+            if (found != byObject.end())
+                type.owner = found->second;
+        }
+        else if (type.superObject)
+        {
+            auto found = byObject.find(type.superObject);
+            if (found != byObject.end() && found->second != &type - types.data() &&
+                (types[found->second].kind == Kind::Class ||
+                 types[found->second].kind == Kind::Struct))
+            {
+                type.super = found->second;
+            }
+        }
+    }
+
+    // Packages differing only in case share a file (case-insensitive file
+    // systems would merge them anyway)
+    std::unordered_map<std::string, int> byPackage;
+    for (Type& type : types)
+    {
+        std::string file = Identifier(type.package);
+        std::string key = file;
+        std::transform(key.begin(), key.end(), key.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        auto inserted = byPackage.emplace(key, static_cast<int>(packages.size()));
+        if (inserted.second)
+            packages.push_back(Package{file, {}, {}});
+        type.packageIndex = inserted.first->second;
+    }
+
+    // C++ names are unique across the whole dump so headers can be mixed;
+    // functions are named after their owner, so they go last
+    std::unordered_set<std::string> used;
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        Type& type = types[i];
+        switch (type.kind)
+        {
+        case Kind::Class:
+            type.cppName = UniqueIdentifier(
+                (IsActor(types, static_cast<int>(i)) ? "A" : "U") + type.name, used);
+            break;
+        case Kind::Struct:
+            type.cppName = UniqueIdentifier("F" + type.name, used);
+            break;
+        case Kind::Enum:
+            type.cppName = UniqueIdentifier(type.name, used);
+            break;
+        default:
+            break;
+        }
+    }
+    for (Type& type : types)
+    {
+        if (type.kind != Kind::Function)
+            continue;
+        std::string owner = type.owner >= 0 ? types[type.owner].cppName
+                                            : Identifier(UE4::GetObjectName(type.outer));
+        type.cppName = UniqueIdentifier(owner + "_" + type.name + "_Params", used);
+    }
+
+    // Enums, then structs and classes with supers first, then functions
+    std::vector<unsigned char> placed(types.size(), 0);
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        if (types[i].kind == Kind::Enum)
+        {
+            placed[i] = 1;
+            packages[types[i].packageIndex].types.push_back(static_cast<int>(i));
+        }
+    }
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        if (types[i].kind == Kind::Class || types[i].kind == Kind::Struct)
+            Order(types, packages, placed, static_cast<int>(i));
+    }
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        if (types[i].kind == Kind::Function)
+            packages[types[i].packageIndex].types.push_back(static_cast<int>(i));
+    }
+
+    for (size_t p = 0; p < packages.size(); ++p)
+    {
+        std::vector<int>& includes = packages[p].includes;
+        for (int index : packages[p].types)
+        {
+            int super = types[index].super;
+            if (super >= 0 && types[super].packageIndex != static_cast<int>(p))
+                includes.push_back(types[super].packageIndex);
+        }
+        std::sort(includes.begin(), includes.end());
+        includes.erase(std::unique(includes.begin(), includes.end()), includes.end());
+    }
+}
+
+// ============================================================================
+// Pass 4: format
+// ============================================================================
+
+struct FieldType {
+    const char* property;
+    const char* cpp;
+    int size;
+};
+
+// Properties with a plain C++ equivalent; everything else is emitted as
+// bytes with its property type in the comment
+static const FieldType g_FieldTypes[] = {
+    {"BoolProperty",   "uint8_t",  1},
+    {"ByteProperty",   "uint8_t",  1},
+    {"Int8Property",   "int8_t",   1},
+    {"Int16Property",  "int16_t",  2},
+    {"UInt16Property", "uint16_t", 2},
+    {"IntProperty",    "int32_t",  4},
+    {"UInt32Property", "uint32_t", 4},
+    {"Int64Property",  "int64_t",  8},
+    {"UInt64Property", "uint64_t", 8},
+    {"FloatProperty",  "float",    4},
+    {"DoubleProperty", "double",   8},
+    {"ObjectProperty", "void*",    8},
+    {"ClassProperty",  "void*",    8},
+};
+
+static const char* CppFieldType(const UE4::PropertyInfo& prop)
+{
+    for (const FieldType& entry : g_FieldTypes)
+    {
+        if (prop.type == entry.property && prop.elementSize == entry.size)
+            return entry.cpp;
+    }
+    return nullptr;
+}
+
+static void AppendField(std::string& out, const std::string& decl, int offset, int bytes,
+                        const char* type)
+{
+    Appendf(out, "    %-40s // 0x%04X (0x%04X)%s%s\n", (decl + ";").c_str(), offset, bytes,
+            *type ? " " : "", type);
+}
+
+static void AppendPad(std::string& out, int from, int to)
+{
+    char decl[64];
+    snprintf(decl, sizeof(decl), "unsigned char pad_%04X[0x%X]", from, to - from);
+    AppendField(out, decl, from, to - from, "");
+}
+
+// Fields between `start` and `size`, sorted by offset and padded; a
+// property that starts inside the previous one (bitfield bools, unions)
+// is listed as a comment
+static void AppendFields(std::string& out, std::vector<const UE4::PropertyInfo*> fields,
+                         int start, int size)
+{
+    std::stable_sort(fields.begin(), fields.end(),
+                     [](const UE4::PropertyInfo* a, const UE4::PropertyInfo* b) {
+                         return a->offset < b->offset;
+                     });
+
+    std::unordered_set<std::string> used;
+    int cursor = start;
+    for (const UE4::PropertyInfo* prop : fields)
+    {
+        int bytes = prop->elementSize * prop->arrayDim;
+        if (prop->offset < cursor || bytes <= 0)
+        {
+            Appendf(out, "    // %s %s at 0x%04X (0x%04X) overlaps the field before\n",
+                    prop->type.c_str(), prop->name.c_str(), prop->offset, bytes);
+            continue;
+        }
+        if (prop->offset > cursor)
+            AppendPad(out, cursor, prop->offset);
+
+        std::string name = UniqueIdentifier(prop->name, used);
+        std::string decl;
+        if (const char* cpp = CppFieldType(*prop))
+        {
+            decl = std::string(cpp) + " " + name;
+        }
+        else
+        {
+            char size[16];
+            snprintf(size, sizeof(size), "[0x%X]", prop->elementSize);
+            decl = "unsigned char " + name + size;
+        }
+        if (prop->arrayDim > 1)
+            decl += "[" + std::to_string(prop->arrayDim) + "]";
+
+        AppendField(out, decl, prop->offset, bytes, prop->type.c_str());
+        cursor = prop->offset + bytes;
+    }
+    if (size > cursor)
+        AppendPad(out, cursor, size);
+}
+
+static void FormatHeader(const std::vector<Type>& types, Type& type)
+{
+    std::string& out = type.header;
+
+    if (type.kind == Kind::Enum)
+    {
+        bool small = true;
+        for (const auto& value : type.values)
+            small = small && value.second >= 0 && value.second <= 0xFF;
+
+        Appendf(out, "// Enum %s.%s\n", type.package.c_str(), type.name.c_str());
+        Appendf(out, "enum class %s : %s {\n", type.cppName.c_str(), small ? "uint8_t" : "int64_t");
+        std::unordered_set<std::string> used;
+        for (const auto& value : type.values)
+        {
+            // Enumerators are stored as "EName::Value" in newer builds
+            size_t scope = value.first.rfind("::");
+            std::string name = scope == std::string::npos ? value.first
+                                                          : value.first.substr(scope + 2);
+            Appendf(out, "    %s = %lld,\n", UniqueIdentifier(name, used).c_str(),
+                    static_cast<long long>(value.second));
+        }
+        out += "};\n\n";
+        return;
+    }
+
+    std::vector<const UE4::PropertyInfo*> fields;
+    for (const UE4::PropertyInfo& prop : type.properties)
+    {
+        if (type.kind != Kind::Function || (prop.flags & CPF_PARM))
+            fields.push_back(&prop);
+    }
+
+    if (type.kind == Kind::Function)
+    {
+        std::string owner = type.owner >= 0 ? types[type.owner].name : UE4::GetObjectName(type.outer);
+        Appendf(out, "// Function %s.%s.%s (0x%X bytes)\n", type.package.c_str(),
+                owner.c_str(), type.name.c_str(), type.size);
+        Appendf(out, "struct %s {\n", type.cppName.c_str());
+        AppendFields(out, fields, 0, type.size);
+        out += "};\n\n";
+        return;
+    }
+
+    int start = 0;
+    Appendf(out, "// %s %s.%s (0x%X bytes)\n", type.kind == Kind::Class ? "Class" : "Struct",
+            type.package.c_str(), type.name.c_str(), type.size);
+    if (type.super >= 0 && types[type.super].size <= type.size)
+    {
+        start = types[type.super].size;
+        Appendf(out, "struct %s : public %s {\n", type.cppName.c_str(),
+                types[type.super].cppName.c_str());
+    }
+    else
+    {
+        Appendf(out, "struct %s {\n", type.cppName.c_str());
+    }
+    AppendFields(out, fields, start, type.size);
+    out += "};\n\n";
+}
+
+// JSON string literal for `text`
+static void AppendJsonString(std::string& out, const std::string& text)
+{
+    out += '"';
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            Appendf(out, "\\u%04x", static_cast<unsigned char>(c));
+        }
+        else
+        {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+// One line of reflection.json. Written by hand rather than through
+// nlohmann::json, whose per-property objects cost more than everything
+// else in the dump together.
+static void FormatJson(const std::vector<Type>& types, Type& type)
+{
+    std::string& out = type.json;
+    out += "{\"kind\":\"";
+    out += KindName(type.kind);
+    out += "\",\"name\":";
+    AppendJsonString(out, type.name);
+    out += ",\"package\":";
+    AppendJsonString(out, type.package);
+    out += ",\"cppName\":";
+    AppendJsonString(out, type.cppName);
+
+    if (type.kind == Kind::Enum)
+    {
+        out += ",\"values\":[";
+        for (size_t i = 0; i < type.values.size(); ++i)
+        {
+            out += i ? ",{\"name\":" : "{\"name\":";
+            AppendJsonString(out, type.values[i].first);
+            Appendf(out, ",\"value\":%lld}", static_cast<long long>(type.values[i].second));
+        }
+        out += "]}";
+        return;
+    }
+
+    if (type.kind == Kind::Function)
+    {
+        out += ",\"owner\":";
+        AppendJsonString(out, type.owner >= 0 ? types[type.owner].name
+                                              : UE4::GetObjectName(type.outer));
+    }
+    else if (type.super >= 0)
+    {
+        out += ",\"super\":";
+        AppendJsonString(out, types[type.super].name);
+    }
+    else
+    {
+        out += ",\"super\":null";
+    }
+    Appendf(out, ",\"size\":%d,\"properties\":[", type.size);
+
+    for (size_t i = 0; i < type.properties.size(); ++i)
+    {
+        const UE4::PropertyInfo& prop = type.properties[i];
+        out += i ? ",{\"name\":" : "{\"name\":";
+        AppendJsonString(out, prop.name);
+        out += ",\"type\":";
+        AppendJsonString(out, prop.type);
+        Appendf(out, ",\"offset\":%d,\"elementSize\":%d,\"arrayDim\":%d,\"flags\":%llu}",
+                prop.offset, prop.elementSize, prop.arrayDim,
+                static_cast<unsigned long long>(prop.flags));
+    }
+    out += "]}";
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+// Collects text and hands it to the file in large writes
+class BatchedWriter {
+public:
+    explicit BatchedWriter(const fs::path& path)
+        : m_file(path, std::ios::binary | std::ios::trunc)
+    {
+        m_buffer.reserve(kBatch);
+    }
+
+    bool IsOpen() const { return m_file.is_open(); }
+    uint64_t Bytes() const { return m_bytes; }
+
+    void Write(const std::string& text)
+    {
+        if (m_buffer.size() + text.size() > kBatch)
+            Flush();
+        if (text.size() >= kBatch)
+            m_file.write(text.data(), static_cast<std::streamsize>(text.size()));
+        else
+            m_buffer += text;
+        m_bytes += text.size();
+    }
+
+    bool Close()
+    {
+        Flush();
+        m_file.close();
+        return !m_file.fail();
+    }
+
+private:
+    static constexpr size_t kBatch = 1 << 20;
+
+    void Flush()
+    {
+        m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+
+    std::ofstream m_file;
+    std::string m_buffer;
+    uint64_t m_bytes = 0;
+};
+
+static bool WriteHeader(const fs::path& directory, const std::vector<Type>& types,
+                        const std::vector<Package>& packages, const Package& package,
+                        uint64_t& bytes)
+{
+    BatchedWriter file(directory / (package.name + ".hpp"));
+    if (!file.IsOpen())
+        return false;
+
+    std::string preamble;
+    Appendf(preamble, "// %s.hpp - generated from GObjects (engine version %d)\n",
+            package.name.c_str(), Globals::dword_18004FDE0);
+    preamble += "#pragma once\n\n#include <cstdint>\n";
+    for (int include : package.includes)
+        Appendf(preamble, "#include \"%s.hpp\"\n", packages[include].name.c_str());
+    preamble += "\n#pragma pack(push, 1)\n\nnamespace SDK {\n\n";
+    file.Write(preamble);
+
+    for (int index : package.types)
+        file.Write(types[index].header);
+
+    file.Write("} // namespace SDK\n\n#pragma pack(pop)\n");
+    bytes = file.Bytes();
+    return file.Close();
+}
+
+static bool WriteJson(const fs::path& path, const std::vector<Type>& types, uint64_t& bytes)
+{
+    BatchedWriter file(path);
+    if (!file.IsOpen())
+        return false;
+
+    file.Write("{\"engineVersion\":" + std::to_string(Globals::dword_18004FDE0) +
+               ",\"types\":[\n");
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        file.Write(types[i].json);
+        file.Write(i + 1 < types.size() ? ",\n" : "\n");
+    }
+    file.Write("]}\n");
+    bytes = file.Bytes();
+    return file.Close();
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+bool Dump(const std::string& directory)
+{
+    UE4::ObjectTable table = UE4::ObjectTable::Capture();
+    if (table.count <= 0 || !Globals::qword_18004FDC8)
+        return false;
+
+    LARGE_INTEGER start;
+    QueryPerformanceCounter(&start);
+
+    bool chain = UE4::UsesPropertyChain();
+    Collected collected;
+    Collect(table, !chain, collected);
+    std::vector<Type>& types = collected.types;
+
+    size_t typeBlocks = (types.size() + TYPE_BLOCK - 1) / TYPE_BLOCK;
+    ForEachBlock(typeBlocks, [&collected, &types, chain](size_t b) {
+        size_t end = std::min(types.size(), (b + 1) * TYPE_BLOCK);
+        for (size_t i = b * TYPE_BLOCK; i < end; ++i)
+            ReadType(types[i], collected, chain);
+    });
+
+    std::vector<Package> packages;
+    Link(types, packages);
+
+    ForEachBlock(typeBlocks, [&types](size_t b) {
+        size_t end = std::min(types.size(), (b + 1) * TYPE_BLOCK);
+        for (size_t i = b * TYPE_BLOCK; i < end; ++i)
+        {
+            FormatHeader(types, types[i]);
+            FormatJson(types, types[i]);
+        }
+    });
+
+    fs::path root(directory);
+    std::vector<uint64_t> headerBytes(packages.size(), 0);
+    std::mutex failedLock;
+    std::string failed;
+    size_t packageBlocks = (packages.size() + PACKAGE_BLOCK - 1) / PACKAGE_BLOCK;
+    ForEachBlock(packageBlocks, [&](size_t b) {
+        size_t end = std::min(packages.size(), (b + 1) * PACKAGE_BLOCK);
+        for (size_t p = b * PACKAGE_BLOCK; p < end; ++p)
+        {
+            if (!WriteHeader(root, types, packages, packages[p], headerBytes[p]))
+            {
+                std::lock_guard<std::mutex> lock(failedLock);
+                if (failed.empty())
+                    failed = (root / (packages[p].name + ".hpp")).string();
+            }
+        }
+    });
+
+    uint64_t jsonBytes = 0;
+    fs::path jsonPath = root / "reflection.json";
+    if (!WriteJson(jsonPath, types, jsonBytes) && failed.empty())
+        failed = jsonPath.string();
+
+    Stats stats{};
+    for (const Type& type : types)
+    {
+        switch (type.kind)
+        {
+        case Kind::Class: ++stats.classes; break;
+        case Kind::Struct: ++stats.structs; break;
+        case Kind::Enum: ++stats.enums; break;
+        case Kind::Function: ++stats.functions; break;
+        default: break;
+        }
+        stats.properties += type.properties.size();
+    }
+    stats.packages = packages.size();
+    stats.bytes = jsonBytes;
+    for (uint64_t bytes : headerBytes)
+        stats.bytes += bytes;
+    stats.timeNs = ElapsedNs(start);
+    {
+        std::lock_guard<std::mutex> lock(g_StatsLock);
+        g_Stats = stats;
+    }
+
+    if (!failed.empty())
+    {
+        MessageBoxA(nullptr, ("Failed to write SDK dump file " + failed).c_str(),
+                    "Error", MB_ICONERROR);
+        return false;
+    }
+    return true;
+}
+
+std::string DefaultDirectory()
+{
+    std::string dir = Config::GetConfigPath();
+    if (dir.empty())
+        return "rift_sdk";
+    if (dir.back() != '\\' && dir.back() != '/')
+        dir += '\\';
+    return dir + "rift_sdk";
+}
+
+bool Requested()
+{
+    std::error_code error;
+    return fs::is_directory(DefaultDirectory(), error);
+}
+
+Stats GetStats()
+{
+    std::lock_guard<std::mutex> lock(g_StatsLock);
+    return g_Stats;
+}
+
+void PublishCounters()
+{
+    Stats stats = GetStats();
+    Telemetry::SetCounter("sdkDump.classes", stats.classes);
+    Telemetry::SetCounter("sdkDump.structs", stats.structs);
+    Telemetry::SetCounter("sdkDump.enums", stats.enums);
+    Telemetry::SetCounter("sdkDump.functions", stats.functions);
+    Telemetry::SetCounter("sdkDump.properties", stats.properties);
+    Telemetry::SetCounter("sdkDump.packages", stats.packages);
+    Telemetry::SetCounter("sdkDump.bytes", stats.bytes);
+    Telemetry::SetCounter("sdkDump.timeNs", stats.timeNs);
+}
+
+} // namespace SdkDump
@@ -0,0 +1,211 @@
+/*
+ * Rift DLL - External Signature Database (runtime)
+ *
+ * Maps a compiled signature image (see signature_db.h for the layout) and
+ * serves version, pattern and patch lookups straight out of the mapping.
+ * Loading only validates the header; individual records are bounds-checked
+ * when they are read, so nothing is walked up front and load time does not
+ * depend on how many versions the image describes.
+ *
+ * The JSON -> image compiler lives in signature_db_compile.cpp and is only
+ * linked into tools/sigdbc.
+ */
+
+#include "signature_db.h"
+#include "encrypted_blobs.h"
+#include <cstring>
+
+namespace SignatureDB {
+
+static const unsigned char* g_Image = nullptr;
+static const Header* g_Header = nullptr;
+
+static constexpr int BLOB_COUNT = static_cast<int>(EncryptedBlobs::BlobId::Count);
+
+// Compiled form of every encrypted blob, for records that refer to one
+static PatternScan::CompiledPattern g_BlobPatterns[BLOB_COUNT];
+
+template <typename T>
+static const T* SectionAt(uint32_t offset)
+{
+    return reinterpret_cast<const T*>(g_Image + offset);
+}
+
+static bool SectionFits(uint32_t offset, uint64_t count, uint64_t elementSize,
+                        uint32_t imageSize)
+{
+    return (offset & 3) == 0 && offset <= imageSize &&
+           count * elementSize <= static_cast<uint64_t>(imageSize - offset);
+}
+
+static bool ValidateHeader(const Header* h, uint64_t fileSize)
+{
+    if (h->magic != kMagic || h->formatVersion != kFormatVersion)
+        return false;
+    if (h->imageSize != fileSize)
+        return false;
+
+    return SectionFits(h->intervalOffset, h->intervalCount, sizeof(VersionInterval), h->imageSize)
+        && SectionFits(h->setOffset, h->setCount, sizeof(PatternSetRecord), h->imageSize)
+        && SectionFits(h->patternOffset, h->patternCount, sizeof(PatternRecord), h->imageSize)
+        && SectionFits(h->patchOffset, h->patchCount, sizeof(PatchRecord), h->imageSize)
+        && SectionFits(h->stringsOffset, h->stringsSize, 1, h->imageSize)
+        && SectionFits(h->bytesOffset, h->bytesSize, 1, h->imageSize)
+        && h->stringsSize > 0
+        && reinterpret_cast<const char*>(h)[h->stringsOffset + h->stringsSize - 1] == '\0';
+}
+
+bool Load(const char* path)
+{
+    if (g_Image)
+        return true;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) ||
+        fileSize.QuadPart < static_cast<LONGLONG>(sizeof(Header)) ||
+        fileSize.QuadPart > 0x7FFFFFFF)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+
+    // The view keeps the mapping alive after its handle is closed
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view)
+        return false;
+
+    const auto* header = static_cast<const Header*>(view);
+    if (!ValidateHeader(header, static_cast<uint64_t>(fileSize.QuadPart)))
+    {
+        UnmapViewOfFile(view);
+        MessageBoxA(nullptr,
+            "The signature database is corrupt or from a different Rift version. "
+            "Falling back to built-in signatures.",
+            "Error", MB_ICONERROR);
+        return false;
+    }
+
+    // Blob records point here; an empty blob (arena not decrypted) leaves
+    // size 0 and its records unreadable
+    for (int i = 0; i < BLOB_COUNT; ++i)
+    {
+        if (!PatternScan::CompilePattern(
+                EncryptedBlobs::Get(static_cast<EncryptedBlobs::BlobId>(i)), g_BlobPatterns[i]))
+            g_BlobPatterns[i].size = 0;
+    }
+
+    g_Image = static_cast<const unsigned char*>(view);
+    g_Header = header;
+    return true;
+}
+
+bool IsLoaded()
+{
+    return g_Image != nullptr;
+}
+
+void Unload()
+{
+    if (!g_Image)
+        return;
+
+    UnmapViewOfFile(g_Image);
+    g_Image = nullptr;
+    g_Header = nullptr;
+}
+
+const VersionFeatures* FindVersionFeatures(int engineVersion)
+{
+    if (!g_Image || !g_Header->intervalCount)
+        return nullptr;
+
+    return VersionManager::SearchIntervals(
+        SectionAt<VersionInterval>(g_Header->intervalOffset),
+        g_Header->intervalCount, engineVersion);
+}
+
+// Fill a PatternRef from a record, rejecting records that point outside
+// the image
+static bool ReadPattern(uint32_t index, PatternRef& out)
+{
+    if (index >= g_Header->patternCount)
+        return false;
+
+    const PatternRecord& rec = SectionAt<PatternRecord>(g_Header->patternOffset)[index];
+    if (rec.nameOffset >= g_Header->stringsSize)
+        return false;
+
+    PatternScan::PatternView pattern;
+    if (rec.size == 0)
+    {
+        if (rec.dataOffset >= static_cast<uint32_t>(BLOB_COUNT) ||
+            g_BlobPatterns[rec.dataOffset].size == 0)
+            return false;
+        pattern = PatternScan::ViewOf(g_BlobPatterns[rec.dataOffset]);
+    }
+    else
+    {
+        if (rec.size > PatternScan::CompiledPattern::kMaxSize ||
+            rec.dataOffset > g_Header->bytesSize ||
+            2ull * rec.size > g_Header->bytesSize - rec.dataOffset)
+            return false;
+
+        const unsigned char* data = SectionAt<unsigned char>(g_Header->bytesOffset) + rec.dataOffset;
+        pattern = PatternScan::PatternView{data, data + rec.size, static_cast<int>(rec.size)};
+    }
+
+    out.name = SectionAt<char>(g_Header->stringsOffset) + rec.nameOffset;
+    out.signatures[0] = Signature{pattern, rec.offset_a, rec.offset_b};
+    out.count = 1;
+    return true;
+}
+
+bool FindPattern(int patternSet, std::string_view name, PatternRef& out)
+{
+    if (!g_Image || patternSet < 0 ||
+        static_cast<uint32_t>(patternSet) >= g_Header->setCount)
+        return false;
+
+    const PatternSetRecord& set = SectionAt<PatternSetRecord>(g_Header->setOffset)[patternSet];
+    out.count = 0;
+    for (uint32_t i = 0; i < set.patternCount; ++i)
+    {
+        PatternRef ref;
+        if (!ReadPattern(set.firstPattern + i, ref) || ref.name != name)
+            continue;
+
+        if (out.count == 0)
+            out.name = ref.name;
+        if (out.count < PatternScan::kMaxAlternatives)
+            out.signatures[out.count++] = ref.signatures[0];
+    }
+
+    return out.count > 0;
+}
+
+uint32_t PatchCount()
+{
+    return g_Image ? g_Header->patchCount : 0;
+}
+
+bool GetPatch(uint32_t index, PatchRecord& patch, PatternRef& pattern)
+{
+    if (!g_Image || index >= g_Header->patchCount)
+        return false;
+
+    patch = SectionAt<PatchRecord>(g_Header->patchOffset)[index];
+    return ReadPattern(patch.patternIndex, pattern);
+}
+
+} // namespace SignatureDB
@@ -0,0 +1,397 @@
+/*
+ * Rift - Signature Database Compiler
+ *
+ * Offline half of the signature database: parses the JSON source with
+ * nlohmann::json, checks it, pre-compiles every pattern into byte/mask form
+ * and writes the binary image described in signature_db.h.
+ *
+ * Only linked into tools/sigdbc; the DLL never parses JSON at startup.
+ *
+ * Source format:
+ *   {
+ *     "patterns": {
+ *       "<id>": { "name": "GObjects", "pattern": "48 8D 05 ? ? ? ?",
+ *                 "offset_a": 3, "offset_b": 0,
+ *                 "alternatives": [                 // optional, in priority order
+ *                   { "pattern": "...", "offset_a": 3, "offset_b": 0 } ] },
+ *       "<id>": { "name": "InputKey", "blob": "InputKey1" }, ...
+ *     },
+ *     "common":      [ "<id>", ... ],          // appended to every set
+ *     "patternSets": [ [ "<id>", ... ], ... ],
+ *     "patches": [
+ *       { "patchSet": "RetStub", "pattern": "<id>", "offset": 0,
+ *         "value": 195, "protect": true }, ...
+ *     ],
+ *     "versions": [
+ *       { "min": 3700114, "max": 3785438, "patternSet": 0,
+ *         "gobjects": "Chunked16", "propertyChain": "ObjectSweep",
+ *         "patches": [ "RetStub" ] }, ...
+ *     ]
+ *   }
+ *
+ * "blob" (instead of "pattern") names an EncryptedBlobs::BlobId. Those
+ * patterns are embedded encrypted on purpose, so neither the source nor
+ * the image carries their text; the record only stores the id.
+ */
+
+#include "signature_db.h"
+#include "encrypted_blobs.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace SignatureDB {
+
+struct CompiledSignature {
+    int offset_a;
+    int offset_b;
+    uint32_t dataOffset;
+    uint32_t size;
+};
+
+// A pattern id: primary signature first, then its alternatives
+struct CompiledSource {
+    std::string name;
+    std::vector<CompiledSignature> signatures;
+};
+
+static bool ParseLayout(const std::string& s, GObjectsLayout& out)
+{
+    if (s == "None")      { out = GObjectsLayout::None;      return true; }
+    if (s == "Flat24")    { out = GObjectsLayout::Flat24;    return true; }
+    if (s == "Chunked32") { out = GObjectsLayout::Chunked32; return true; }
+    if (s == "Chunked16") { out = GObjectsLayout::Chunked16; return true; }
+    return false;
+}
+
+static bool ParseChainMode(const std::string& s, PropertyChainMode& out)
+{
+    if (s == "ObjectSweep")  { out = PropertyChainMode::ObjectSweep;  return true; }
+    if (s == "PropertyLink") { out = PropertyChainMode::PropertyLink; return true; }
+    return false;
+}
+
+static bool ParsePatchSet(const std::string& s, unsigned char& out)
+{
+    if (s == "RetStub")   { out = PATCH_RET_STUB;   return true; }
+    if (s == "ByteFlags") { out = PATCH_BYTE_FLAGS; return true; }
+    return false;
+}
+
+static bool ParseBlob(const std::string& s, uint32_t& out)
+{
+    using EncryptedBlobs::BlobId;
+    static const std::pair<const char*, BlobId> kBlobs[] = {
+        {"HookPatchTarget",    BlobId::HookPatchTarget},
+        {"HookPatchSecondary", BlobId::HookPatchSecondary},
+        {"AdditionalHookFunc", BlobId::AdditionalHookFunc},
+        {"AdditionalAddr",     BlobId::AdditionalAddr},
+        {"InputKey1",          BlobId::InputKey1},
+        {"InputKey2",          BlobId::InputKey2},
+        {"InputKey3",          BlobId::InputKey3},
+        {"InputKey4",          BlobId::InputKey4},
+    };
+    for (const auto& blob : kBlobs)
+    {
+        if (s == blob.first) { out = static_cast<uint32_t>(blob.second); return true; }
+    }
+    return false;
+}
+
+template <typename T>
+static void Append(std::vector<unsigned char>& image, const T* data, size_t count)
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+    image.insert(image.end(), bytes, bytes + sizeof(T) * count);
+}
+
+static void AlignTo4(std::vector<unsigned char>& image)
+{
+    while (image.size() & 3)
+        image.push_back(0);
+}
+
+bool CompileSource(const std::string& jsonPath, const std::string& imagePath,
+                   std::string& error)
+{
+    nlohmann::json j;
+    try {
+        std::ifstream file(jsonPath);
+        if (!file.is_open())
+        {
+            error = "cannot open " + jsonPath;
+            return false;
+        }
+        file >> j;
+    }
+    catch (const nlohmann::json::exception& e) {
+        error = e.what();
+        return false;
+    }
+
+    try {
+        // ----------------------------------------------------------------
+        // Patterns: compile once, store data and names once per id
+        // ----------------------------------------------------------------
+        std::vector<unsigned char> bytes;
+        std::string strings;
+        std::map<std::string, CompiledSource> patterns;
+
+        auto compileSignature = [&](const std::string& id, const nlohmann::json& p,
+                                    CompiledSource& src) {
+            CompiledSignature sig;
+            sig.offset_a = p.value("offset_a", 0);
+            sig.offset_b = p.value("offset_b", 0);
+
+            if (p.contains("blob"))
+            {
+                std::string blob = p["blob"].get<std::string>();
+                if (!ParseBlob(blob, sig.dataOffset))
+                {
+                    error = "pattern '" + id + "' names unknown blob '" + blob + "'";
+                    return false;
+                }
+                sig.size = 0;
+                src.signatures.push_back(sig);
+                return true;
+            }
+
+            PatternScan::CompiledPattern compiled;
+            std::string text = p.at("pattern").get<std::string>();
+            if (!PatternScan::CompilePattern(text, compiled))
+            {
+                error = "pattern '" + id + "' is empty or too long";
+                return false;
+            }
+
+            sig.dataOffset = static_cast<uint32_t>(bytes.size());
+            sig.size = static_cast<uint32_t>(compiled.size);
+            bytes.insert(bytes.end(), compiled.bytes, compiled.bytes + compiled.size);
+            bytes.insert(bytes.end(), compiled.mask, compiled.mask + compiled.size);
+            src.signatures.push_back(sig);
+            return true;
+        };
+
+        for (auto it = j.at("patterns").begin(); it != j.at("patterns").end(); ++it)
+        {
+            const auto& p = it.value();
+            CompiledSource src;
+            src.name = p.at("name").get<std::string>();
+            if (!compileSignature(it.key(), p, src))
+                return false;
+
+            if (p.contains("alternatives"))
+            {
+                for (const auto& alt : p["alternatives"])
+                {
+                    if (!compileSignature(it.key(), alt, src))
+                        return false;
+                }
+            }
+
+            if (src.signatures.size() > static_cast<size_t>(PatternScan::kMaxAlternatives))
+            {
+                error = "pattern '" + it.key() + "' has more than " +
+                        std::to_string(PatternScan::kMaxAlternatives) + " signatures";
+                return false;
+            }
+            patterns[it.key()] = src;
+        }
+
+        std::map<std::string, uint32_t> nameOffsets;
+        auto internName = [&](const std::string& name) {
+            auto found = nameOffsets.find(name);
+            if (found != nameOffsets.end())
+                return found->second;
+            uint32_t offset = static_cast<uint32_t>(strings.size());
+            strings += name;
+            strings.push_back('\0');
+            nameOffsets[name] = offset;
+            return offset;
+        };
+
+        // Emits the primary record, then (in sets only) one record per
+        // alternative with the same name; index is the primary's
+        std::vector<PatternRecord> records;
+        auto emitRecord = [&](const std::string& id, uint32_t& index, bool withAlternatives) {
+            auto found = patterns.find(id);
+            if (found == patterns.end())
+            {
+                error = "unknown pattern id '" + id + "'";
+                return false;
+            }
+            const CompiledSource& src = found->second;
+            index = static_cast<uint32_t>(records.size());
+            size_t emit = withAlternatives ? src.signatures.size() : 1;
+            for (size_t i = 0; i < emit; ++i)
+            {
+                const CompiledSignature& sig = src.signatures[i];
+                records.push_back(PatternRecord{internName(src.name), sig.offset_a,
+                                                sig.offset_b, sig.dataOffset, sig.size});
+            }
+            return true;
+        };
+
+        // ----------------------------------------------------------------
+        // Pattern sets: contiguous record runs, common ids appended
+        // ----------------------------------------------------------------
+        std::vector<std::string> common;
+        if (j.contains("common"))
+            common = j["common"].get<std::vector<std::string>>();
+
+        std::vector<PatternSetRecord> sets;
+        for (const auto& set : j.at("patternSets"))
+        {
+            PatternSetRecord rec{static_cast<uint32_t>(records.size()), 0};
+            std::vector<std::string> ids = set.get<std::vector<std::string>>();
+            ids.insert(ids.end(), common.begin(), common.end());
+            for (const auto& id : ids)
+            {
+                uint32_t index;
+                if (!emitRecord(id, index, true))
+                    return false;
+            }
+            rec.patternCount = static_cast<uint32_t>(records.size()) - rec.firstPattern;
+            sets.push_back(rec);
+        }
+
+        // ----------------------------------------------------------------
+        // Patches: each gets its own record after the sets
+        // ----------------------------------------------------------------
+        std::vector<PatchRecord> patches;
+        if (j.contains("patches"))
+        {
+            for (const auto& p : j["patches"])
+            {
+                PatchRecord rec{};
+                if (!ParsePatchSet(p.at("patchSet").get<std::string>(), rec.patchSet))
+                {
+                    error = "unknown patchSet '" + p.at("patchSet").get<std::string>() + "'";
+                    return false;
+                }
+                if (!emitRecord(p.at("pattern").get<std::string>(), rec.patternIndex, false))
+                    return false;
+                rec.offset = p.value("offset", 0);
+                rec.value = static_cast<uint8_t>(p.at("value").get<int>());
+                rec.protect = p.value("protect", false) ? 1 : 0;
+                patches.push_back(rec);
+            }
+        }
+
+        // ----------------------------------------------------------------
+        // Version intervals: must be sorted and disjoint
+        // ----------------------------------------------------------------
+        std::vector<VersionInterval> intervals;
+        for (const auto& v : j.at("versions"))
+        {
+            VersionInterval iv{};
+            iv.version_min = v.at("min").get<int>();
+            iv.version_max = v.at("max").get<int>();
+            iv.features.patternSet = v.at("patternSet").get<int>();
+            iv.features.patches = PATCH_NONE;
+
+            if (!ParseLayout(v.value("gobjects", std::string("None")),
+                             iv.features.gobjectsLayout) ||
+                !ParseChainMode(v.value("propertyChain", std::string("ObjectSweep")),
+                                iv.features.propertyChain))
+            {
+                error = "bad gobjects/propertyChain for version " + std::to_string(iv.version_min);
+                return false;
+            }
+
+            if (v.contains("patches"))
+            {
+                for (const auto& name : v["patches"])
+                {
+                    unsigned char flag;
+                    if (!ParsePatchSet(name.get<std::string>(), flag))
+                    {
+                        error = "unknown patch set in version " + std::to_string(iv.version_min);
+                        return false;
+                    }
+                    iv.features.patches |= flag;
+                }
+            }
+
+            if (iv.version_min > iv.version_max || iv.features.patternSet < 0 ||
+                iv.features.patternSet >= static_cast<int>(sets.size()))
+            {
+                error = "bad range or pattern set for version " + std::to_string(iv.version_min);
+                return false;
+            }
+            intervals.push_back(iv);
+        }
+
+        std::sort(intervals.begin(), intervals.end(),
+            [](const VersionInterval& a, const VersionInterval& b) {
+                return a.version_min < b.version_min;
+            });
+        for (size_t i = 1; i < intervals.size(); ++i)
+        {
+            if (intervals[i - 1].version_max >= intervals[i].version_min)
+            {
+                error = "version ranges overlap at " + std::to_string(intervals[i].version_min);
+                return false;
+            }
+        }
+
+        // ----------------------------------------------------------------
+        // Emit the image
+        // ----------------------------------------------------------------
+        if (strings.empty())
+            strings.push_back('\0');
+
+        std::vector<unsigned char> image(sizeof(Header), 0);
+        Header header{};
+        header.magic = kMagic;
+        header.formatVersion = kFormatVersion;
+
+        header.intervalOffset = static_cast<uint32_t>(image.size());
+        header.intervalCount = static_cast<uint32_t>(intervals.size());
+        Append(image, intervals.data(), intervals.size());
+
+        header.setOffset = static_cast<uint32_t>(image.size());
+        header.setCount = static_cast<uint32_t>(sets.size());
+        Append(image, sets.data(), sets.size());
+
+        header.patternOffset = static_cast<uint32_t>(image.size());
+        header.patternCount = static_cast<uint32_t>(records.size());
+        Append(image, records.data(), records.size());
+
+        header.patchOffset = static_cast<uint32_t>(image.size());
+        header.patchCount = static_cast<uint32_t>(patches.size());
+        Append(image, patches.data(), patches.size());
+
+        header.stringsOffset = static_cast<uint32_t>(image.size());
+        header.stringsSize = static_cast<uint32_t>(strings.size());
+        Append(image, strings.data(), strings.size());
+        AlignTo4(image);
+
+        header.bytesOffset = static_cast<uint32_t>(image.size());
+        header.bytesSize = static_cast<uint32_t>(bytes.size());
+        Append(image, bytes.data(), bytes.size());
+        AlignTo4(image);
+
+        header.imageSize = static_cast<uint32_t>(image.size());
+        memcpy(image.data(), &header, sizeof(header));
+
+        std::ofstream out(imagePath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            error = "cannot write " + imagePath;
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(image.data()),
+                  static_cast<std::streamsize>(image.size()));
+        return out.good();
+    }
+    catch (const nlohmann::json::exception& e) {
+        error = e.what();
+        return false;
+    }
+}
+
+} // namespace SignatureDB
@@ -0,0 +1,76 @@
+/*
+ * Rift DLL - Startup Arena
+ *
+ * Not present in the original binary. sub_180001020 builds nine configs,
+ * 45 pattern entries and their strings with individual heap allocations
+ * that live for the whole process; here they come out of one monotonic
+ * arena that is dropped after the last pattern has been resolved.
+ */
+
+#include "startup_arena.h"
+#include "telemetry.h"
+
+namespace StartupArena {
+
+// Large enough for all nine built-in configs in a single block
+static constexpr size_t kInitialBlockSize = 32 * 1024;
+
+// Pass-through resource that counts what goes through it
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream)
+        : m_upstream(upstream) {}
+
+    uint64_t Calls() const { return m_calls; }
+    uint64_t Bytes() const { return m_bytes; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++m_calls;
+        m_bytes += bytes;
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        m_upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* m_upstream;
+    uint64_t m_calls = 0;
+    uint64_t m_bytes = 0;
+};
+
+// heap <- g_Blocks (block count) <- g_Arena <- g_Front (allocation count)
+static CountingResource g_Blocks(std::pmr::new_delete_resource());
+static std::pmr::monotonic_buffer_resource g_Arena(kInitialBlockSize, &g_Blocks);
+static CountingResource g_Front(&g_Arena);
+
+std::pmr::memory_resource* Resource()
+{
+    return &g_Front;
+}
+
+Stats GetStats()
+{
+    return Stats{g_Front.Calls(), g_Front.Bytes(), g_Blocks.Calls(), g_Blocks.Bytes()};
+}
+
+void Release()
+{
+    Stats stats = GetStats();
+    Telemetry::SetCounter("startupArena.allocations", stats.allocations);
+    Telemetry::SetCounter("startupArena.bytesRequested", stats.bytesRequested);
+    Telemetry::SetCounter("startupArena.blocks", stats.blocks);
+    Telemetry::SetCounter("startupArena.bytesReserved", stats.bytesReserved);
+
+    g_Arena.release();
+}
+
+} // namespace StartupArena
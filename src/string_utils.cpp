@@ -6,6 +6,9 @@
  *   sub_180004DE0 (0x180004DE0) - String split by delimiter
  *   sub_180004F70 (0x180004F70) - String to uppercase
  *
+ * NarrowToWide, BytesEqual and WideEquals are not in the original binary;
+ * they let name lookups compare engine wchar_t buffers without narrowing.
+ *
  * These are MSVC STL helper functions used throughout the DLL.
  * The original implementations use MSVC std::locale and std::ctype<wchar_t>,
  * but the observable behavior is straightforward ASCII conversion.
@@ -14,6 +17,7 @@
 #include "string_utils.h"
 #include <locale>
 #include <cctype>
+#include <emmintrin.h>
 
 namespace StringUtils {
 
@@ -102,4 +106,40 @@ std::string ToUpper(const std::string& str)
     return result;
 }
 
+std::wstring NarrowToWide(std::string_view str)
+{
+    std::wstring result(str.size(), L'\0');
+    for (size_t i = 0; i < str.size(); ++i)
+        result[i] = static_cast<wchar_t>(static_cast<unsigned char>(str[i]));
+    return result;
+}
+
+bool BytesEqual(const void* a, const void* b, size_t size)
+{
+    const unsigned char* left = static_cast<const unsigned char*>(a);
+    const unsigned char* right = static_cast<const unsigned char*>(b);
+
+    for (; size >= 16; left += 16, right += 16, size -= 16)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF)
+            return false;
+    }
+
+    // Names are short; the tail is usually all there is
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (left[i] != right[i])
+            return false;
+    }
+    return true;
+}
+
+bool WideEquals(const wchar_t* wstr, size_t len, std::wstring_view target)
+{
+    return len == target.size() &&
+           BytesEqual(wstr, target.data(), len * sizeof(wchar_t));
+}
+
 } // namespace StringUtils
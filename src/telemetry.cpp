@@ -0,0 +1,209 @@
+/*
+ * Rift DLL - Scan Telemetry
+ *
+ * Not present in the original binary. Records one entry per pattern
+ * resolution so a "pattern mismatch" report comes with what was scanned,
+ * how long it took and how many matches there were.
+ */
+
+#include "telemetry.h"
+#include "config.h"
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Telemetry {
+
+// A slot is claimed with one fetch_add on g_Next and published by setting
+// `ready` with release semantics; readers only look at ready slots
+struct Slot {
+    ScanRecord record;
+    std::atomic<bool> ready;
+};
+
+static Slot g_Slots[kCapacity];
+static std::atomic<size_t> g_Next{0};
+static std::atomic<size_t> g_Dropped{0};
+
+// Counters use the same claim/publish scheme; a name is looked up among
+// the published slots before a new one is claimed
+struct CounterSlot {
+    char name[32];
+    std::atomic<uint64_t> value;
+    std::atomic<bool> ready;
+};
+
+static CounterSlot g_Counters[kMaxCounters];
+static std::atomic<size_t> g_NextCounter{0};
+
+#ifdef _DEBUG
+static std::atomic<bool> g_Exhaustive{true};
+#else
+static std::atomic<bool> g_Exhaustive{false};
+#endif
+
+bool ExhaustiveScans()
+{
+    return g_Exhaustive.load(std::memory_order_relaxed);
+}
+
+void SetExhaustiveScans(bool enabled)
+{
+    g_Exhaustive.store(enabled, std::memory_order_relaxed);
+}
+
+void RecordScan(std::string_view name, int patternSet,
+                const PatternScan::ScanStats& stats,
+                uintptr_t resolved, HMODULE module)
+{
+    size_t index = g_Next.fetch_add(1, std::memory_order_relaxed);
+    if (index >= kCapacity)
+    {
+        g_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ScanRecord& rec = g_Slots[index].record;
+    size_t len = name.size() < sizeof(rec.name) - 1 ? name.size() : sizeof(rec.name) - 1;
+    memcpy(rec.name, name.data(), len);
+    rec.name[len] = '\0';
+    rec.engineVersion = Globals::dword_18004FDE0;
+    rec.patternSet = patternSet;
+    rec.tier = stats.tier;
+    rec.exhaustive = stats.exhaustive;
+    rec.bytesScanned = stats.bytesScanned;
+    rec.candidatesTested = stats.candidatesTested;
+    rec.alternative = stats.alternative;
+    rec.matchCount = stats.matchCount;
+    rec.wallTimeNs = stats.wallTimeNs;
+    rec.rva = resolved ? resolved - reinterpret_cast<uintptr_t>(module) : 0;
+
+    g_Slots[index].ready.store(true, std::memory_order_release);
+}
+
+size_t Snapshot(ScanRecord* out, size_t maxRecords)
+{
+    size_t written = g_Next.load(std::memory_order_acquire);
+    if (written > kCapacity)
+        written = kCapacity;
+
+    size_t count = 0;
+    for (size_t i = 0; i < written && count < maxRecords; ++i)
+    {
+        if (g_Slots[i].ready.load(std::memory_order_acquire))
+            out[count++] = g_Slots[i].record;
+    }
+    return count;
+}
+
+size_t DroppedCount()
+{
+    return g_Dropped.load(std::memory_order_relaxed);
+}
+
+void SetCounter(std::string_view name, uint64_t value)
+{
+    size_t used = g_NextCounter.load(std::memory_order_acquire);
+    if (used > kMaxCounters)
+        used = kMaxCounters;
+    for (size_t i = 0; i < used; ++i)
+    {
+        CounterSlot& slot = g_Counters[i];
+        if (slot.ready.load(std::memory_order_acquire) && name == slot.name)
+        {
+            slot.value.store(value, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    size_t index = g_NextCounter.fetch_add(1, std::memory_order_relaxed);
+    if (index >= kMaxCounters)
+    {
+        g_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    CounterSlot& slot = g_Counters[index];
+    size_t len = name.size() < sizeof(slot.name) - 1 ? name.size() : sizeof(slot.name) - 1;
+    memcpy(slot.name, name.data(), len);
+    slot.name[len] = '\0';
+    slot.value.store(value, std::memory_order_relaxed);
+    slot.ready.store(true, std::memory_order_release);
+}
+
+static const char* TierName(PatternScan::ScanTier tier)
+{
+    switch (tier)
+    {
+    case PatternScan::ScanTier::Scalar: return "scalar";
+    }
+    return "unknown";
+}
+
+bool Dump(const std::string& path)
+{
+    static ScanRecord records[kCapacity];
+    size_t count = Snapshot(records, kCapacity);
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ScanRecord& rec = records[i];
+        nlohmann::json j;
+        j["pattern"] = rec.name;
+        j["engineVersion"] = rec.engineVersion;
+        j["patternSet"] = rec.patternSet;
+        j["tier"] = TierName(rec.tier);
+        j["exhaustive"] = rec.exhaustive;
+        j["bytesScanned"] = rec.bytesScanned;
+        j["candidatesTested"] = rec.candidatesTested;
+        j["alternative"] = rec.alternative;
+        j["matchCount"] = rec.matchCount;
+        j["wallTimeNs"] = rec.wallTimeNs;
+        j["rva"] = rec.rva;
+        file << j.dump() << '\n';
+    }
+
+    size_t counters = g_NextCounter.load(std::memory_order_acquire);
+    for (size_t i = 0; i < counters && i < kMaxCounters; ++i)
+    {
+        const CounterSlot& slot = g_Counters[i];
+        if (!slot.ready.load(std::memory_order_acquire))
+            continue;
+        nlohmann::json j;
+        j["counter"] = slot.name;
+        j["value"] = slot.value.load(std::memory_order_relaxed);
+        file << j.dump() << '\n';
+    }
+
+    if (DroppedCount())
+        file << nlohmann::json{{"dropped", DroppedCount()}}.dump() << '\n';
+
+    return file.good();
+}
+
+std::string DefaultDumpPath()
+{
+    std::string dir = Config::GetConfigPath();
+    if (dir.empty())
+        return "rift_telemetry.jsonl";
+    if (dir.back() != '\\' && dir.back() != '/')
+        dir += '\\';
+    return dir + "rift_telemetry.jsonl";
+}
+
+bool DumpRequested()
+{
+#ifdef _DEBUG
+    return true;
+#else
+    std::error_code error;
+    return std::filesystem::exists(DefaultDumpPath(), error);
+#endif
+}
+
+} // namespace Telemetry
@@ -0,0 +1,104 @@
+/*
+ * Rift DLL - Startup Thread Pool
+ *
+ * Not present in the original binary. Used to run independent pattern
+ * scans concurrently instead of one after another.
+ */
+
+#include "thread_pool.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ThreadPool {
+
+// Workers never exit, so the shared state is deliberately never destroyed;
+// tearing it down in a static destructor would pull it out from under them.
+struct PoolState {
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<std::function<void()>> queue;
+    unsigned workers = 0;
+};
+
+static PoolState& State()
+{
+    static PoolState* state = new PoolState();
+    return *state;
+}
+
+unsigned WorkerCount()
+{
+    unsigned hw = std::thread::hardware_concurrency();
+    if (hw < 2)
+        return 2;
+    return hw > 4 ? 4 : hw;
+}
+
+unsigned HelperCount(size_t blocks)
+{
+    if (!blocks)
+        return 0;
+
+    unsigned hw = std::thread::hardware_concurrency();
+    unsigned helpers = WorkerCount();
+    if (hw && hw - 1 < helpers)
+        helpers = hw - 1;
+    if (blocks - 1 < helpers)
+        helpers = static_cast<unsigned>(blocks - 1);
+    return helpers;
+}
+
+static DWORD WINAPI WorkerThread(LPVOID)
+{
+    PoolState& pool = State();
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            pool.wake.wait(lock, [&pool]() { return !pool.queue.empty(); });
+            task = std::move(pool.queue.front());
+            pool.queue.pop_front();
+        }
+        task();
+    }
+}
+
+// Caller holds pool.mutex
+static void StartWorkers(PoolState& pool)
+{
+    unsigned target = WorkerCount();
+    while (pool.workers < target)
+    {
+        HANDLE thread = CreateThread(nullptr, 0, WorkerThread, nullptr, 0, nullptr);
+        if (!thread)
+            break;
+        CloseHandle(thread);
+        ++pool.workers;
+    }
+}
+
+bool Enqueue(std::function<void()> task)
+{
+    PoolState& pool = State();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (!pool.workers)
+            StartWorkers(pool);
+
+        if (pool.workers)
+        {
+            pool.queue.push_back(std::move(task));
+            pool.wake.notify_one();
+            return true;
+        }
+    }
+
+    // No worker could be created: degrade to running inline
+    task();
+    return false;
+}
+
+} // namespace ThreadPool
@@ -41,8 +41,22 @@
 
 #include "ue4_sdk.h"
 #include "string_utils.h"
+#include "version_config.h"
+#include "name_cache.h"
+#include "object_index.h"
+#include "thread_pool.h"
+#include "safe_memory.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <condition_variable>
 #include <cstring>
 #include <cwchar>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace UE4 {
 
@@ -51,12 +65,14 @@ namespace UE4 {
 // ============================================================================
 
 // UObject field offsets
+static constexpr int CLASS_OFFSET = 16;          // ClassPrivate at UObject + 0x10
 static constexpr int FNAME_OFFSET = 24;          // FName at UObject + 0x18
 static constexpr int OUTER_OFFSET = 32;           // Outer at UObject + 0x20
 
 // Type 1 array layout
 static constexpr int TYPE1_COUNT_OFFSET = 12;     // *(int*)(base + 12)
 static constexpr int TYPE1_ELEMENT_STRIDE = 24;   // 24 bytes per element slot
+static constexpr int ITEM_SERIAL_OFFSET = 16;     // FUObjectItem::SerialNumber
 
 // Type 2 array layout
 static constexpr int TYPE2_COUNT_OFFSET = 20;     // *(int*)(base + 20)
@@ -65,34 +81,56 @@ static constexpr int TYPE2_CHUNK_SIZE = 0xFFFF;   // Max objects per chunk
 // Property offset field within UProperty
 static constexpr int PROP_OFFSET_FIELD = 68;      // 0x44 - Offset_Internal
 
+// Size and flags of a UProperty (object sweep layout)
+static constexpr int PROP_ARRAYDIM_FIELD = 48;     // 0x30 - ArrayDim
+static constexpr int PROP_ELEMENTSIZE_FIELD = 52;  // 0x34 - ElementSize
+static constexpr int PROP_FLAGS_FIELD = 56;        // 0x38 - PropertyFlags
+
 // Newer UE4 property chain layout (version >= 11794982)
 static constexpr int CLASS_PROPLINK_OFFSET = 80;   // UStruct::PropertyLink at +0x50
 static constexpr int PROP_NEXT_OFFSET = 32;        // Property chain next ptr at +0x20
 static constexpr int PROP_NAME_OFFSET_NEW = 40;    // FName in property chain at +0x28
 static constexpr int PROP_OFFSET_FIELD_NEW = 76;   // 0x4C - Offset in property chain
-
-// Version threshold for newer property chain walk
-static constexpr int VERSION_PROPCHAIN = 11794982;
+static constexpr int PROP_ARRAYDIM_FIELD_NEW = 56;     // 0x38 - FProperty::ArrayDim
+static constexpr int PROP_ELEMENTSIZE_FIELD_NEW = 60;  // 0x3C - FProperty::ElementSize
+static constexpr int PROP_FLAGS_FIELD_NEW = 64;        // 0x40 - FProperty::PropertyFlags
+static constexpr int PROP_CLASS_OFFSET_NEW = 8;        // FField::ClassPrivate (FName at +0)
+
+// UStruct and UEnum fields read by the reflection readers
+static constexpr int STRUCT_SUPER_OFFSET = 48;         // 0x30 - SuperStruct (object sweep)
+static constexpr int STRUCT_SIZE_OFFSET = 64;          // 0x40 - PropertiesSize (object sweep)
+static constexpr int STRUCT_SUPER_OFFSET_NEW = 64;     // 0x40 - SuperStruct (PropertyLink)
+static constexpr int STRUCT_SIZE_OFFSET_NEW = 88;      // 0x58 - PropertiesSize (PropertyLink)
+static constexpr int ENUM_NAMES_OFFSET = 64;           // 0x40 - TArray<TPair<FName, int64>>
+static constexpr int ENUM_PAIR_SIZE = 16;
+static constexpr int ENUM_MAX_NAMES = 0x10000;
+
+// EPropertyFlags of function parameters
+static constexpr uint64_t CPF_PARM = 0x80;
+static constexpr uint64_t CPF_RETURN_PARM = 0x400;
 
 // ============================================================================
 // Internal helper: Get name string from a UObject
 // ============================================================================
 
-// Reads FName at objectPtr + offset, calls the resolved FNameToString function
-// pointer (qword_18004FDC8), then narrows the wide string result.
+// An engine FString as FNameToString fills it: { wchar_t* Data, int32 Num,
+// int32 Max }, Num counting the terminator
+struct WideName {
+    const wchar_t* data;    // nullptr if the engine returned no data
+    size_t length;          // characters, without the terminator
+};
+
+// Calls the resolved FNameToString function pointer (qword_18004FDC8) on an
+// 8-byte FName value. Only reached on a NameCache miss.
 //
 // Original pattern:
 //   v20 = *(_QWORD *)(object + 24);
 //   v21[0] = 0; v21[1] = 0;
 //   qword_18004FDC8(&v20, v21);
 //   if (v21[0]) sub_180005030(v21, output);
-static std::string GetNameAtOffset(__int64 objectPtr, int offset)
+static WideName FetchWideName(uint64_t value)
 {
-    if (!objectPtr || !Globals::qword_18004FDC8)
-        return "";
-
-    // Read FName value (8 bytes at the given offset)
-    __int64 fname = *reinterpret_cast<__int64*>(objectPtr + offset);
+    __int64 fname = static_cast<__int64>(value);
 
     // FString output: { wchar_t* Data, int32 Num+Max packed }
     __int64 fstringBuf[2] = {0, 0};
@@ -102,18 +140,135 @@ static std::string GetNameAtOffset(__int64 objectPtr, int offset)
         Globals::qword_18004FDC8);
     fnameToStr(&fname, fstringBuf);
 
+    if (!fstringBuf[0])
+        return WideName{nullptr, 0};
+
+    // fstringBuf[0] = wchar_t* pointer to the name data; the low dword of
+    // fstringBuf[1] is Num (wcslen if it was left unset)
+    const wchar_t* wdata = reinterpret_cast<const wchar_t*>(fstringBuf[0]);
+    int num = static_cast<int>(fstringBuf[1] & 0xFFFFFFFF);
+    return WideName{wdata, num > 0 ? static_cast<size_t>(num - 1) : wcslen(wdata)};
+}
+
+// Name of an FName, narrowed for NameCache
+static std::string ResolveFName(uint64_t value)
+{
+    WideName name = FetchWideName(value);
+
     // If no data returned, return empty string
     // (original falls through to sub_180030850 to create empty std::string)
-    if (!fstringBuf[0])
+    if (!name.data)
         return "";
 
     // Convert wide string to narrow
-    // fstringBuf[0] = wchar_t* pointer to the name data
-    const wchar_t* wdata = reinterpret_cast<const wchar_t*>(fstringBuf[0]);
-    size_t wlen = wcslen(wdata);
-    return StringUtils::WideToNarrow(wdata, wlen);
+    return StringUtils::WideToNarrow(name.data, name.length);
 }
 
+// Reads FName at objectPtr + offset and returns its cached name
+static NameCache::Name GetNameRefAtOffset(__int64 objectPtr, int offset)
+{
+    if (!objectPtr || !Globals::qword_18004FDC8)
+    {
+        static const NameCache::Name empty = std::make_shared<const std::string>();
+        return empty;
+    }
+
+    // Read FName value (8 bytes at the given offset)
+    uint64_t fname = *reinterpret_cast<uint64_t*>(objectPtr + offset);
+    return NameCache::Lookup(fname, ResolveFName);
+}
+
+// Owned copy, for callers that keep the name
+static std::string GetNameAtOffset(__int64 objectPtr, int offset)
+{
+    return *GetNameRefAtOffset(objectPtr, offset);
+}
+
+// ============================================================================
+// Internal helper: match an object's name against a target without
+// converting every visited name to a string
+// ============================================================================
+//
+// The engine resolver for string -> FName isn't among the resolved
+// patterns, so a target's FName value is learned from the first object
+// whose name string equals it and remembered for the rest of the process.
+// Once known, a sweep compares the raw 8-byte FName (ComparisonIndex +
+// Number) and only compares names to confirm a hit.
+//
+// A name compare never builds a string: a cached name is compared in place
+// inside NameCache, and an uncached one is compared as the engine's
+// wchar_t buffer against the target widened once per NameTarget (length
+// first, then SIMD). The name is narrowed only to be cached.
+
+static std::shared_mutex g_KnownNamesLock;
+static std::unordered_map<std::string, uint64_t> g_KnownNames;
+
+// Shared by the threads of a ParallelSweep; whichever thread learns the
+// FName first publishes it to the others. Owns its text, so it may be
+// built from a const char* (FindBatch queries) without dangling.
+struct NameTarget {
+    const std::string text;
+    const std::wstring wide;
+    std::atomic<uint64_t> fname{0};
+    std::atomic<bool> known{false};
+
+    explicit NameTarget(const std::string& name)
+        : text(name), wide(StringUtils::NarrowToWide(name))
+    {
+        std::shared_lock<std::shared_mutex> read(g_KnownNamesLock);
+        auto found = g_KnownNames.find(name);
+        if (found != g_KnownNames.end())
+        {
+            fname = found->second;
+            known = true;
+        }
+    }
+
+    // Whether FName `value` names the target
+    bool NameEquals(uint64_t value) const
+    {
+        if (!Globals::qword_18004FDC8)
+            return false;
+
+        switch (NameCache::Compare(value, text))
+        {
+        case NameCache::Match::Equal:
+            return true;
+        case NameCache::Match::Different:
+            return false;
+        case NameCache::Match::Missing:
+            break;
+        }
+
+        WideName name = FetchWideName(value);
+        if (!name.data)
+        {
+            NameCache::Insert(value, std::string());
+            return text.empty();
+        }
+
+        bool equal = StringUtils::WideEquals(name.data, name.length, wide);
+        NameCache::Insert(value, StringUtils::WideToNarrow(name.data, name.length));
+        return equal;
+    }
+
+    bool Matches(__int64 objectPtr, int offset)
+    {
+        uint64_t value = *reinterpret_cast<uint64_t*>(objectPtr + offset);
+        if (known.load(std::memory_order_acquire))
+            return value == fname.load(std::memory_order_relaxed) && NameEquals(value);
+
+        if (!NameEquals(value))
+            return false;
+
+        fname.store(value, std::memory_order_relaxed);
+        known.store(true, std::memory_order_release);
+        std::unique_lock<std::shared_mutex> write(g_KnownNamesLock);
+        g_KnownNames.emplace(text, value);
+        return true;
+    }
+};
+
 // ============================================================================
 // GObjects search: Type 1 - Linear array (sub_1800056F0)
 // ============================================================================
@@ -122,29 +277,34 @@ static std::string GetNameAtOffset(__int64 objectPtr, int offset)
 // Iterates a flat array of object pointers with 24-byte stride.
 // Array pointer at *(QWORD*)gobjectsBase, count at *(int*)(gobjectsBase + 12).
 // For each non-null object, gets FName at +24, converts to string, compares.
+// Here the comparison goes through NameTarget (integer FName compare).
 // Returns matching object pointer or 0.
 
-static __int64 FindObjectType1(__int64 gobjectsBase, const std::string& name)
+// Object in slot `index` of a captured table (0 for an empty slot)
+static __int64 ObjectAt(const ObjectTable& table, int index)
 {
-    int count = *reinterpret_cast<int*>(gobjectsBase + TYPE1_COUNT_OFFSET);
-    if (count <= 0)
+    ObjectIterator it(table, index);
+    return it.Next() && it.Index() == index ? it.Object() : 0;
+}
+
+// Shared by both layouts: the first match of a ParallelSweep over the table
+static __int64 FindObjectInTable(const ObjectTable& table, const std::string& name)
+{
+    if (table.count <= 0)
         return 0;
 
-    __int64 arrayPtr = *reinterpret_cast<__int64*>(gobjectsBase);
+    NameTarget target(name);
 
-    for (int i = 0; i < count; ++i)
-    {
-        __int64 obj = *reinterpret_cast<__int64*>(
-            arrayPtr + static_cast<__int64>(i) * TYPE1_ELEMENT_STRIDE);
-        if (!obj)
-            continue;
+    int index = ParallelSweep(table, [&target](__int64 obj, int) {
+        return target.Matches(obj, FNAME_OFFSET);
+    });
 
-        std::string objName = GetNameAtOffset(obj, FNAME_OFFSET);
-        if (objName == name)
-            return obj;
-    }
+    return index < 0 ? 0 : ObjectAt(table, index);
+}
 
-    return 0;
+static __int64 FindObjectType1(__int64 gobjectsBase, const std::string& name)
+{
+    return FindObjectInTable(ObjectTable::Capture(1, gobjectsBase), name);
 }
 
 // ============================================================================
@@ -199,32 +359,255 @@ static __int64 ChunkedArrayAccess(__int64 arrayBase, int index)
 }
 
 // ============================================================================
-// GObjects search: Type 2 - Chunked array (sub_180006450)
+// GObjects table snapshot and forward iterator
 // ============================================================================
 //
-// Original: sub_180006450(__int64 gobjectsBase, _QWORD* targetName)
-// Same algorithm as Type 1 but uses ChunkedArrayAccess (sub_1800063A0)
-// instead of direct pointer arithmetic.
-// Count at *(int*)(gobjectsBase + 20).
+// Sweeping with ChunkedArrayAccess rescans the chunk pointer array for every
+// element. ObjectTable locates the valid chunks once; ObjectIterator then
+// visits the same slots in the same order as calling ChunkedArrayAccess for
+// index 0, 1, 2, ...:
+//   chunk 0 holds indices 0 .. 0xFFFF        (within-chunk slots 0 .. 0xFFFF)
+//   chunk k holds the next 0xFFFF indices    (within-chunk slots 1 .. 0xFFFF)
+// which is what the "exact multiple of 0xFFFF" edge case above produces.
+
+ObjectTable ObjectTable::Capture()
+{
+    __int64 patternLink = Globals::qword_18004FDF0;
+    if (!patternLink)
+        return ObjectTable{0, 0, 0, nullptr, 0};
 
-static __int64 FindObjectType2(__int64 gobjectsBase, const std::string& name)
+    unsigned char type = *reinterpret_cast<unsigned char*>(patternLink);
+    __int64 gobjectsBase = *reinterpret_cast<__int64*>(patternLink + 8);
+    return Capture(type, gobjectsBase);
+}
+
+ObjectTable ObjectTable::Capture(unsigned char type, __int64 gobjectsBase)
 {
-    int count = *reinterpret_cast<int*>(gobjectsBase + TYPE2_COUNT_OFFSET);
-    if (count <= 0)
-        return 0;
+    ObjectTable table{0, 0, 0, nullptr, 0};
 
-    for (int i = 0; i < count; ++i)
+    if (type == 1)
     {
-        __int64 obj = ChunkedArrayAccess(gobjectsBase, i);
-        if (!obj)
-            continue;
+        table.type = 1;
+        table.count = *reinterpret_cast<int*>(gobjectsBase + TYPE1_COUNT_OFFSET);
+        table.flatArray = *reinterpret_cast<__int64*>(gobjectsBase);
+    }
+    else if (type == 2)
+    {
+        table.type = 2;
+        table.count = *reinterpret_cast<int*>(gobjectsBase + TYPE2_COUNT_OFFSET);
+        if (table.count <= 0)
+            return table;
+
+        // Same chunk discovery as ChunkedArrayAccess, done once
+        const __int64* chunks = *reinterpret_cast<__int64**>(gobjectsBase);
+        int firstValid = 0;
+        while (!chunks[firstValid])
+            ++firstValid;
+        int lastValid = firstValid;
+        while (chunks[lastValid])
+            ++lastValid;
 
-        std::string objName = GetNameAtOffset(obj, FNAME_OFFSET);
-        if (objName == name)
-            return obj;
+        table.chunks = chunks + firstValid;
+        table.chunkCount = lastValid - firstValid;
     }
 
-    return 0;
+    return table;
+}
+
+ObjectIterator::ObjectIterator(const ObjectTable& table)
+    : m_table(table)
+{
+    if (table.type == 1)
+        m_slot = table.flatArray - TYPE1_ELEMENT_STRIDE;
+}
+
+ObjectIterator::ObjectIterator(const ObjectTable& table, int first)
+    : ObjectIterator(table)
+{
+    if (first <= 0)
+        return;
+    if (first >= table.count)
+    {
+        m_index = table.count;
+        return;
+    }
+
+    // Park on slot first - 1 so the next Next() lands on `first`
+    m_index = first - 1;
+    if (table.type == 1)
+    {
+        m_slot = table.flatArray + static_cast<__int64>(m_index) * TYPE1_ELEMENT_STRIDE;
+        return;
+    }
+
+    // Same chunk split as ChunkedArrayAccess; `first` is never slot 0 of a
+    // chunk, so slot first - 1 is in the same chunk
+    int chunkIdx = first / TYPE2_CHUNK_SIZE;
+    if (chunkIdx && TYPE2_CHUNK_SIZE * chunkIdx == first)
+        --chunkIdx;
+    if (chunkIdx >= table.chunkCount)
+    {
+        m_index = table.count;
+        return;
+    }
+
+    __int64 chunkPtr = table.chunks[chunkIdx];
+    int withinChunk = first - TYPE2_CHUNK_SIZE * chunkIdx;
+    m_chunk = chunkIdx;
+    m_slot = chunkPtr + static_cast<__int64>(withinChunk - 1) * TYPE1_ELEMENT_STRIDE;
+    m_chunkEnd = chunkPtr + static_cast<__int64>(TYPE2_CHUNK_SIZE) * TYPE1_ELEMENT_STRIDE;
+}
+
+int ObjectIterator::Serial() const
+{
+    return m_object ? *reinterpret_cast<int*>(m_slot + ITEM_SERIAL_OFFSET) : 0;
+}
+
+bool ObjectIterator::Next()
+{
+    while (++m_index < m_table.count)
+    {
+        if (m_table.type == 1)
+        {
+            m_slot += TYPE1_ELEMENT_STRIDE;
+        }
+        else if (m_chunk < 0 || m_slot == m_chunkEnd)
+        {
+            // Past the last valid chunk every remaining index reads as 0
+            if (++m_chunk >= m_table.chunkCount)
+                break;
+
+            __int64 chunkPtr = m_table.chunks[m_chunk];
+            m_slot = chunkPtr + (m_chunk ? TYPE1_ELEMENT_STRIDE : 0);
+            m_chunkEnd = chunkPtr + static_cast<__int64>(TYPE2_CHUNK_SIZE) * TYPE1_ELEMENT_STRIDE;
+        }
+        else
+        {
+            m_slot += TYPE1_ELEMENT_STRIDE;
+        }
+
+        m_object = *reinterpret_cast<__int64*>(m_slot);
+        if (m_object)
+            return true;
+    }
+
+    m_index = m_table.count;
+    m_object = 0;
+    return false;
+}
+
+// ============================================================================
+// Parallel GObjects sweep
+// ============================================================================
+//
+// Not in the original binary, which walks GObjects on one thread. Blocks of
+// SWEEP_BLOCK slots are claimed in index order from a shared counter by the
+// calling thread and up to WorkerCount() pool tasks. `best` holds the
+// lowest match so far: a claimed block that starts past it is dropped and
+// a block in progress stops at it. Every block below the final `best` was
+// claimed before any block past it and scanned up to it, so the result is
+// the lowest matching index whatever the scheduling.
+//
+// Pool tasks that start late (the pool may still be busy with pattern
+// scans) find no block left and return; the caller only waits for tasks
+// that are inside SweepBlocks.
+
+static constexpr int SWEEP_BLOCK = 8192;
+
+struct SweepState {
+    ObjectTable table;
+    const std::function<bool(__int64, int)>* visit;  // valid while blocks remain
+    int blocks;
+    std::atomic<int> nextBlock{0};
+    std::atomic<int> best{INT_MAX};
+    std::atomic<int> active{0};                      // pool tasks in SweepBlocks
+    std::mutex doneLock;
+    std::condition_variable done;
+};
+
+static void SweepBlocks(SweepState& state)
+{
+    for (;;)
+    {
+        int block = state.nextBlock.fetch_add(1);
+        if (block >= state.blocks)
+            return;
+
+        // Blocks are claimed in order, so every later one starts further out
+        int first = block * SWEEP_BLOCK;
+        if (first > state.best.load(std::memory_order_relaxed))
+            return;
+
+        int end = first + SWEEP_BLOCK < state.table.count ? first + SWEEP_BLOCK
+                                                          : state.table.count;
+        for (ObjectIterator it(state.table, first); it.Next() && it.Index() < end;)
+        {
+            if (it.Index() > state.best.load(std::memory_order_relaxed))
+                return;
+            if (!(*state.visit)(it.Object(), it.Index()))
+                continue;
+
+            int best = state.best.load();
+            while (it.Index() < best && !state.best.compare_exchange_weak(best, it.Index()))
+            {
+            }
+            return;
+        }
+    }
+}
+
+static void SweepTask(const std::shared_ptr<SweepState>& state)
+{
+    // Counted before claiming a block so the caller can't miss this task
+    state->active.fetch_add(1);
+    SweepBlocks(*state);
+    if (state->active.fetch_sub(1) == 1)
+    {
+        std::lock_guard<std::mutex> lock(state->doneLock);
+        state->done.notify_all();
+    }
+}
+
+int ParallelSweep(const ObjectTable& table,
+                  const std::function<bool(__int64 object, int index)>& visit)
+{
+    if (table.count <= 0)
+        return -1;
+
+    auto state = std::make_shared<SweepState>();
+    state->table = table;
+    state->visit = &visit;
+    state->blocks = (table.count + SWEEP_BLOCK - 1) / SWEEP_BLOCK;
+
+    // The calling thread takes blocks too; small tables, and machines with
+    // a single core, stay on it
+    unsigned helpers = ThreadPool::HelperCount(static_cast<size_t>(state->blocks));
+    for (unsigned i = 0; i < helpers; ++i)
+        ThreadPool::Enqueue([state]() { SweepTask(state); });
+
+    SweepBlocks(*state);
+
+    {
+        std::unique_lock<std::mutex> lock(state->doneLock);
+        state->done.wait(lock, [&state]() { return state->active.load() == 0; });
+    }
+
+    int best = state->best.load();
+    return best == INT_MAX ? -1 : best;
+}
+
+// ============================================================================
+// GObjects search: Type 2 - Chunked array (sub_180006450)
+// ============================================================================
+//
+// Original: sub_180006450(__int64 gobjectsBase, _QWORD* targetName)
+// Same algorithm as Type 1 but uses ChunkedArrayAccess (sub_1800063A0)
+// instead of direct pointer arithmetic; here both go through ObjectIterator.
+// Count at *(int*)(gobjectsBase + 20).
+
+static __int64 FindObjectType2(__int64 gobjectsBase, const std::string& name)
+{
+    return FindObjectInTable(ObjectTable::Capture(2, gobjectsBase), name);
 }
 
 // ============================================================================
@@ -245,42 +628,115 @@ static __int64 FindObjectType2(__int64 gobjectsBase, const std::string& name)
 //         return *(int*)(object + 68)       // Offset_Internal
 //   return 0
 
-static int FindPropertyType1(__int64 gobjectsBase,
-                              const std::string& className,
-                              const std::string& propName)
+// Shared by both layouts: first object named like `target` whose Outer is
+// named `outerName` (a property or function of a class)
+static __int64 FindChildInTable(const ObjectTable& table, NameTarget& target,
+                                const std::string& outerName)
 {
-    int count = *reinterpret_cast<int*>(gobjectsBase + TYPE1_COUNT_OFFSET);
-    if (count <= 0)
+    if (table.count <= 0)
         return 0;
 
-    __int64 arrayPtr = *reinterpret_cast<__int64*>(gobjectsBase);
-
-    for (int i = 0; i < count; ++i)
-    {
-        __int64 obj = *reinterpret_cast<__int64*>(
-            arrayPtr + static_cast<__int64>(i) * TYPE1_ELEMENT_STRIDE);
-        if (!obj)
-            continue;
+    NameTarget outerTarget(outerName);
 
+    int index = ParallelSweep(table, [&target, &outerTarget](__int64 obj, int) {
         // Check if this object's name matches the property name
-        std::string objName = GetNameAtOffset(obj, FNAME_OFFSET);
-        if (objName != propName)
-            continue;
+        if (!target.Matches(obj, FNAME_OFFSET))
+            return false;
 
         // Match found - check the owning class name
         // Follow Outer pointer at +32 to get class object,
         // then get class name at +24 from that object
         // Original: v46 = *(_QWORD *)(*(_QWORD *)(v8 + 32) + 24LL)
         __int64 outerObj = *reinterpret_cast<__int64*>(obj + OUTER_OFFSET);
-        if (!outerObj)
+        return outerObj && outerTarget.Matches(outerObj, FNAME_OFFSET);
+    });
+
+    return index < 0 ? 0 : ObjectAt(table, index);
+}
+
+static int FindPropertyInTable(const ObjectTable& table, NameTarget& propTarget,
+                               const std::string& className)
+{
+    // Return the Offset_Internal field at UProperty + 68
+    __int64 prop = FindChildInTable(table, propTarget, className);
+    return prop ? *reinterpret_cast<int*>(prop + PROP_OFFSET_FIELD) : 0;
+}
+
+static int FindPropertyType1(__int64 gobjectsBase,
+                              const std::string& className,
+                              const std::string& propName)
+{
+    NameTarget propTarget(propName);
+    return FindPropertyInTable(ObjectTable::Capture(1, gobjectsBase), propTarget, className);
+}
+
+// Bytes of a property chain node read by the walks below
+static constexpr int PROP_NODE_SIZE = PROP_OFFSET_FIELD_NEW + 4;
+
+// Fault-safe copy of one property chain node; its fields are then read
+// from the copy
+struct PropNode {
+    alignas(8) unsigned char bytes[PROP_NODE_SIZE];
+
+    bool Load(__int64 address) { return SafeMemory::Read(address, bytes); }
+    __int64 Address() const { return reinterpret_cast<__int64>(bytes); }
+
+    template <typename T>
+    T Field(int offset) const
+    {
+        T value;
+        std::memcpy(&value, bytes + offset, sizeof(T));
+        return value;
+    }
+};
+
+// Walk UStruct::PropertyLink of a class (version >= 11794982) for the
+// property named by `propTarget`; returns its offset at +76, or 0
+static int FindInPropertyChain(__int64 classObj, NameTarget& propTarget)
+{
+    // Walk the property linked list starting at class + 80 (PropertyLink)
+    __int64 propNode = *reinterpret_cast<__int64*>(classObj + CLASS_PROPLINK_OFFSET);
+    bool refreshed = false;
+
+    while (propNode)
+    {
+        // Safety check (original uses IsBadReadPtr on the node)
+        PropNode node;
+        if (!node.Load(propNode))
+        {
+            // The node may have been allocated since the snapshot, which
+            // IsReadable only retakes every kMinRefreshMs: retake it once
+            // per walk before giving up
+            if (refreshed)
+                return 0;
+            refreshed = true;
+            SafeMemory::Refresh();
+            continue;
+        }
+
+        // Check if the property node is valid
+        __int64 propData = node.Field<__int64>(PROP_CLASS_OFFSET_NEW);
+        if (!propData || !SafeMemory::IsReadable(reinterpret_cast<const void*>(propData), 8))
+        {
+            // Move to next property in chain
+            propNode = node.Field<__int64>(PROP_NEXT_OFFSET);
             continue;
+        }
 
-        std::string outerName = GetNameAtOffset(outerObj, FNAME_OFFSET);
-        if (outerName == className)
+        // Check property offset field (must be non-zero)
+        int offset = node.Field<int>(PROP_OFFSET_FIELD_NEW);
+        if (!offset)
         {
-            // Return the Offset_Internal field at UProperty + 68
-            return *reinterpret_cast<int*>(obj + PROP_OFFSET_FIELD);
+            propNode = node.Field<__int64>(PROP_NEXT_OFFSET);
+            continue;
         }
+
+        // Get property name at +40 and compare
+        if (propTarget.Matches(node.Address(), PROP_NAME_OFFSET_NEW))
+            return offset;
+
+        // Move to next property
+        propNode = node.Field<__int64>(PROP_NEXT_OFFSET);
     }
 
     return 0;
@@ -293,13 +749,13 @@ static int FindPropertyType1(__int64 gobjectsBase,
 // Original: sub_180006CA0(__int64 gobjectsBase, unsigned __int64* className,
 //                         _QWORD** propName)
 //
-// Two code paths based on engine version:
+// Two code paths, selected by VersionFeatures::propertyChain:
 //
-// 1. Version < 11794982:
+// 1. ObjectSweep (version < 11794982):
 //    Same as Type 1 but uses ChunkedArrayAccess for iteration.
 //    Property offset at UProperty + 68 (0x44).
 //
-// 2. Version >= 11794982:
+// 2. PropertyLink (version >= 11794982):
 //    First finds the CLASS object in GObjects by name (via sub_180006450).
 //    Then walks the property linked list:
 //      - Start: *(QWORD*)(classObj + 80) = UStruct::PropertyLink
@@ -312,84 +768,257 @@ static int FindPropertyType2(__int64 gobjectsBase,
                               const std::string& className,
                               const std::string& propName)
 {
-    int version = Globals::dword_18004FDE0;
+    const VersionFeatures* features = VersionManager::CurrentFeatures();
+    NameTarget propTarget(propName);
 
-    if (version < VERSION_PROPCHAIN)
+    if (!features || features->propertyChain == PropertyChainMode::ObjectSweep)
     {
         // Older path: iterate all objects via chunked array
-        int count = *reinterpret_cast<int*>(gobjectsBase + TYPE2_COUNT_OFFSET);
-        if (count <= 0)
-            return 0;
+        return FindPropertyInTable(ObjectTable::Capture(2, gobjectsBase),
+                                   propTarget, className);
+    }
 
-        for (int i = 0; i < count; ++i)
-        {
-            __int64 obj = ChunkedArrayAccess(gobjectsBase, i);
-            if (!obj)
-                continue;
+    // PropertyLink path (version >= 11794982):
+    // Find the class object first, then walk its property chain.
+    __int64 classObj = ObjectIndex::Find(className);
+    if (!classObj)
+        classObj = FindObjectType2(gobjectsBase, className);
+    if (!classObj)
+        return 0;
 
-            // Check property name
-            std::string objName = GetNameAtOffset(obj, FNAME_OFFSET);
-            if (objName != propName)
-                continue;
+    return FindInPropertyChain(classObj, propTarget);
+}
 
-            // Check owning class name via Outer at +32
-            __int64 outerPtr = *reinterpret_cast<__int64*>(obj + OUTER_OFFSET);
-            if (!outerPtr)
-                continue;
+// ============================================================================
+// Reflection readers
+// ============================================================================
+//
+// Not in the original binary. Read what the SDK dump needs from classes,
+// structs, functions and enums. Properties come from the same places the
+// property lookups above use; chain nodes and enum arrays are copied with
+// SafeMemory since nothing else vouches for them.
 
-            std::string outerName = GetNameAtOffset(outerPtr, FNAME_OFFSET);
-            if (outerName == className)
-            {
-                // Return Offset_Internal at UProperty + 68
-                return *reinterpret_cast<int*>(obj + PROP_OFFSET_FIELD);
-            }
-        }
+bool UsesPropertyChain()
+{
+    __int64 patternLink = Globals::qword_18004FDF0;
+    if (!patternLink || *reinterpret_cast<unsigned char*>(patternLink) != 2)
+        return false;
 
-        return 0;
+    const VersionFeatures* features = VersionManager::CurrentFeatures();
+    return features && features->propertyChain == PropertyChainMode::PropertyLink;
+}
+
+PropertyInfo ReadPropertyObject(__int64 prop)
+{
+    return PropertyInfo{
+        GetObjectName(prop),
+        GetObjectName(GetObjectClass(prop)),
+        *reinterpret_cast<int*>(prop + PROP_OFFSET_FIELD),
+        *reinterpret_cast<int*>(prop + PROP_ARRAYDIM_FIELD),
+        *reinterpret_cast<int*>(prop + PROP_ELEMENTSIZE_FIELD),
+        *reinterpret_cast<uint64_t*>(prop + PROP_FLAGS_FIELD)};
+}
+
+void ReadPropertyChain(__int64 structObj, std::vector<PropertyInfo>& out)
+{
+    __int64 propNode = *reinterpret_cast<__int64*>(structObj + CLASS_PROPLINK_OFFSET);
+    PropNode node;
+    while (propNode && node.Load(propNode))
+    {
+        // FFieldClass::Name names the property type
+        uint64_t typeName = 0;
+        __int64 fieldClass = node.Field<__int64>(PROP_CLASS_OFFSET_NEW);
+        bool typed = fieldClass && SafeMemory::Read(fieldClass, typeName);
+
+        out.push_back(PropertyInfo{
+            GetNameAtOffset(node.Address(), PROP_NAME_OFFSET_NEW),
+            typed ? GetNameAtOffset(reinterpret_cast<__int64>(&typeName), 0) : std::string(),
+            node.Field<int>(PROP_OFFSET_FIELD_NEW),
+            node.Field<int>(PROP_ARRAYDIM_FIELD_NEW),
+            node.Field<int>(PROP_ELEMENTSIZE_FIELD_NEW),
+            node.Field<uint64_t>(PROP_FLAGS_FIELD_NEW)});
+        propNode = node.Field<__int64>(PROP_NEXT_OFFSET);
     }
+}
 
-    // Newer path (version >= 11794982):
-    // Find the class object first, then walk its property chain.
-    __int64 classObj = FindObjectType2(gobjectsBase, className);
-    if (!classObj)
-        return 0;
+StructLayout ReadStructLayout(__int64 structObj)
+{
+    bool chain = UsesPropertyChain();
+    StructLayout layout{0, 0};
+    if (!SafeMemory::Read(structObj + (chain ? STRUCT_SUPER_OFFSET_NEW : STRUCT_SUPER_OFFSET),
+                          layout.super) ||
+        !SafeMemory::Read(structObj + (chain ? STRUCT_SIZE_OFFSET_NEW : STRUCT_SIZE_OFFSET),
+                          layout.size))
+    {
+        return StructLayout{0, 0};
+    }
+    return layout;
+}
 
-    // Walk the property linked list starting at class + 80 (PropertyLink)
-    __int64 propNode = *reinterpret_cast<__int64*>(classObj + CLASS_PROPLINK_OFFSET);
+bool ReadEnumNames(__int64 enumObj, std::vector<std::pair<std::string, int64_t>>& out)
+{
+    TArray<unsigned char> names;
+    if (!SafeMemory::Read(enumObj + ENUM_NAMES_OFFSET, names) ||
+        names.count < 0 || names.count > ENUM_MAX_NAMES || (names.count && !names.data))
+    {
+        return false;
+    }
 
-    while (propNode)
+    std::vector<unsigned char> pairs(static_cast<size_t>(names.count) * ENUM_PAIR_SIZE);
+    if (!pairs.empty() && !SafeMemory::Read(names.data, pairs.data(), pairs.size()))
+        return false;
+
+    for (int i = 0; i < names.count; ++i)
     {
-        // Safety check (original uses IsBadReadPtr)
-        if (IsBadReadPtr(reinterpret_cast<const void*>(propNode), 8))
-            return 0;
+        __int64 pair = reinterpret_cast<__int64>(pairs.data()) + i * ENUM_PAIR_SIZE;
+        out.emplace_back(GetNameAtOffset(pair, 0), *reinterpret_cast<int64_t*>(pair + 8));
+    }
+    return true;
+}
 
-        // Check if the property node is valid
-        __int64 propData = *reinterpret_cast<__int64*>(propNode + 8);
-        if (IsBadReadPtr(reinterpret_cast<const void*>(propData), 8) || !propData)
-        {
-            // Move to next property in chain
-            propNode = *reinterpret_cast<__int64*>(propNode + PROP_NEXT_OFFSET);
-            continue;
-        }
+// ============================================================================
+// UFunction lookup and parameter layout
+// ============================================================================
+//
+// Not in the original binary, which passes hand-built parameter arrays to
+// ProcessEvent. A UFunction is a UStruct whose parameters are its
+// CPF_Parm properties: on the property chain layout they hang off the
+// function's PropertyLink like a class's properties; on the object sweep
+// layout they are UProperty objects whose Outer is the function, in
+// GObjects order (which is declaration order).
 
-        // Check property offset field (must be non-zero)
-        int offset = *reinterpret_cast<int*>(propNode + PROP_OFFSET_FIELD_NEW);
-        if (!offset)
+static std::shared_mutex g_FunctionsLock;
+static std::unordered_map<std::string, std::unique_ptr<FunctionInfo>> g_Functions;
+
+static void AppendParam(PropertyInfo& prop, std::vector<FunctionInfo::Param>& params)
+{
+    if (prop.flags & CPF_PARM)
+    {
+        params.push_back(FunctionInfo::Param{
+            std::move(prop.name), prop.offset, prop.elementSize * prop.arrayDim, prop.flags});
+    }
+}
+
+static void ReadChainParams(__int64 function, std::vector<FunctionInfo::Param>& params)
+{
+    std::vector<PropertyInfo> props;
+    ReadPropertyChain(function, props);
+    for (PropertyInfo& prop : props)
+        AppendParam(prop, params);
+}
+
+static void ReadSweepParams(__int64 function, std::vector<FunctionInfo::Param>& params)
+{
+    // One whole-array walk; only an Outer compare per object
+    std::mutex foundLock;
+    std::vector<std::pair<int, __int64>> found;
+    ParallelSweep(ObjectTable::Capture(), [function, &foundLock, &found](__int64 obj, int index) {
+        if (GetObjectOuter(obj) == function)
         {
-            propNode = *reinterpret_cast<__int64*>(propNode + PROP_NEXT_OFFSET);
-            continue;
+            std::lock_guard<std::mutex> lock(foundLock);
+            found.emplace_back(index, obj);
         }
+        return false;
+    });
+    std::sort(found.begin(), found.end());
 
-        // Get property name at +40 and compare
-        std::string nodeName = GetNameAtOffset(propNode, PROP_NAME_OFFSET_NEW);
-        if (nodeName == propName)
-            return offset;
+    for (const auto& entry : found)
+    {
+        PropertyInfo prop = ReadPropertyObject(entry.second);
+        AppendParam(prop, params);
+    }
+}
 
-        // Move to next property
-        propNode = *reinterpret_cast<__int64*>(propNode + PROP_NEXT_OFFSET);
+static std::unique_ptr<FunctionInfo> ResolveFunction(const std::string& className,
+                                                     const std::string& functionName)
+{
+    __int64 patternLink = Globals::qword_18004FDF0;
+    if (!patternLink)
+        return nullptr;
+
+    __int64 function = ObjectIndex::FindInOuter(className, functionName);
+    if (!function)
+    {
+        NameTarget target(functionName);
+        function = FindChildInTable(ObjectTable::Capture(), target, className);
+    }
+    if (!function)
+        return nullptr;
+
+    auto info = std::make_unique<FunctionInfo>();
+    info->function = function;
+    info->returnParam = -1;
+
+    if (UsesPropertyChain())
+        ReadChainParams(function, info->params);
+    else
+        ReadSweepParams(function, info->params);
+
+    int end = 0;
+    for (size_t i = 0; i < info->params.size(); ++i)
+    {
+        const FunctionInfo::Param& param = info->params[i];
+        if (param.offset + param.size > end)
+            end = param.offset + param.size;
+        if (param.flags & CPF_RETURN_PARM)
+            info->returnParam = static_cast<int>(i);
+        else
+            info->inputs.push_back(static_cast<int>(i));
     }
+    info->paramsSize = (end + 7) & ~7;
+    return info;
+}
 
-    return 0;
+int FunctionInfo::ParamOffset(std::string_view name) const
+{
+    for (const Param& param : params)
+    {
+        if (param.name == name)
+            return param.offset;
+    }
+    return -1;
+}
+
+const FunctionInfo* FindFunction(const char* qualifiedName)
+{
+    {
+        std::shared_lock<std::shared_mutex> read(g_FunctionsLock);
+        auto found = g_Functions.find(qualifiedName);
+        if (found != g_Functions.end())
+            return found->second.get();
+    }
+
+    const char* separator = std::strchr(qualifiedName, ':');
+    if (!separator)
+        return nullptr;
+
+    std::unique_ptr<FunctionInfo> info = ResolveFunction(
+        std::string(qualifiedName, separator), std::string(separator + 1));
+    if (!info)
+        return nullptr;
+
+    // Another thread may have resolved it meanwhile; keep the first
+    std::unique_lock<std::shared_mutex> write(g_FunctionsLock);
+    auto inserted = g_Functions.emplace(qualifiedName, std::move(info));
+    return inserted.first->second.get();
+}
+
+void Invoke(__int64 object, const FunctionInfo& info, void* params)
+{
+    ProcessEvent(reinterpret_cast<UObject*>(object),
+                 reinterpret_cast<UFunction*>(info.function), params);
+}
+
+const FunctionInfo* FunctionHandle::Resolve() const
+{
+    const FunctionInfo* info = m_info.load(std::memory_order_acquire);
+    if (!info)
+    {
+        info = FindFunction(m_name);
+        if (info)
+            m_info.store(info, std::memory_order_release);
+    }
+    return info;
 }
 
 // ============================================================================
@@ -421,24 +1050,128 @@ std::string FNameToString(int nameIndex)
         return "";
 
     // FName value (index-based, 8 bytes for alignment)
-    __int64 fname = static_cast<__int64>(nameIndex);
+    uint64_t fname = static_cast<uint64_t>(static_cast<__int64>(nameIndex));
+    return *NameCache::Lookup(fname, ResolveFName);
+}
 
-    __int64 fstringBuf[2] = {0, 0};
-    auto fnameToStr = reinterpret_cast<void(__fastcall*)(__int64*, __int64*)>(
-        Globals::qword_18004FDC8);
-    fnameToStr(&fname, fstringBuf);
+std::string GetObjectName(__int64 objectPtr)
+{
+    return GetNameAtOffset(objectPtr, FNAME_OFFSET);
+}
 
-    if (!fstringBuf[0])
-        return "";
+NameCache::Name GetObjectNameRef(__int64 objectPtr)
+{
+    return GetNameRefAtOffset(objectPtr, FNAME_OFFSET);
+}
 
-    const wchar_t* wdata = reinterpret_cast<const wchar_t*>(fstringBuf[0]);
-    size_t wlen = wcslen(wdata);
-    return StringUtils::WideToNarrow(wdata, wlen);
+NameCache::Name GetNameRef(uint64_t fname)
+{
+    if (!Globals::qword_18004FDC8)
+    {
+        static const NameCache::Name empty = std::make_shared<const std::string>();
+        return empty;
+    }
+    return NameCache::Lookup(fname, ResolveFName);
 }
 
-std::string GetObjectName(__int64 objectPtr)
+int GetObjectCount()
 {
-    return GetNameAtOffset(objectPtr, FNAME_OFFSET);
+    return ObjectTable::Capture().count;
+}
+
+__int64 GetObjectByIndex(int index)
+{
+    __int64 patternLink = Globals::qword_18004FDF0;
+    if (!patternLink)
+        return 0;
+
+    unsigned char type = *reinterpret_cast<unsigned char*>(patternLink);
+    __int64 gobjectsBase = *reinterpret_cast<__int64*>(patternLink + 8);
+
+    if (type == 1)
+    {
+        __int64 arrayPtr = *reinterpret_cast<__int64*>(gobjectsBase);
+        return *reinterpret_cast<__int64*>(
+            arrayPtr + static_cast<__int64>(index) * TYPE1_ELEMENT_STRIDE);
+    }
+    if (type == 2)
+        return ChunkedArrayAccess(gobjectsBase, index);
+    return 0;
+}
+
+uint64_t GetObjectFName(__int64 objectPtr)
+{
+    return objectPtr ? *reinterpret_cast<uint64_t*>(objectPtr + FNAME_OFFSET) : 0;
+}
+
+__int64 GetObjectOuter(__int64 objectPtr)
+{
+    return objectPtr ? *reinterpret_cast<__int64*>(objectPtr + OUTER_OFFSET) : 0;
+}
+
+__int64 GetObjectClass(__int64 objectPtr)
+{
+    return objectPtr ? *reinterpret_cast<__int64*>(objectPtr + CLASS_OFFSET) : 0;
+}
+
+// ============================================================================
+// Property offset cache
+// ============================================================================
+//
+// Every (class, property) pair resolved so far, keyed "Class::Property".
+// Property offsets never change while the game runs.
+
+static std::shared_mutex g_OffsetCacheLock;
+static std::unordered_map<std::string, int> g_OffsetCache;
+
+static std::string OffsetKey(const char* className, const char* propertyName)
+{
+    return std::string(className) + "::" + propertyName;
+}
+
+static bool LookupCachedOffset(const char* className, const char* propertyName, int& offset)
+{
+    std::shared_lock<std::shared_mutex> read(g_OffsetCacheLock);
+    auto found = g_OffsetCache.find(OffsetKey(className, propertyName));
+    if (found == g_OffsetCache.end())
+        return false;
+    offset = found->second;
+    return true;
+}
+
+static void CacheOffset(const char* className, const char* propertyName, int offset)
+{
+    std::unique_lock<std::shared_mutex> write(g_OffsetCacheLock);
+    g_OffsetCache[OffsetKey(className, propertyName)] = offset;
+}
+
+void ResetCaches()
+{
+    ObjectIndex::Reset();
+    NameCache::Clear();
+    {
+        std::unique_lock<std::shared_mutex> write(g_KnownNamesLock);
+        g_KnownNames.clear();
+    }
+    std::unique_lock<std::shared_mutex> write(g_OffsetCacheLock);
+    g_OffsetCache.clear();
+}
+
+static std::atomic<bool> g_LookupBoxes{true};
+
+void SetLookupBoxes(bool show)
+{
+    g_LookupBoxes.store(show, std::memory_order_relaxed);
+}
+
+// The box StaticFindObject and FindPropertyOffset show on a miss
+static void ReportNullValue()
+{
+    if (!g_LookupBoxes.load(std::memory_order_relaxed))
+        return;
+    MessageBoxA(nullptr,
+        "Value is NULL, please report the game version to Rift developers.",
+        "Error", MB_ICONERROR);
 }
 
 // Original: sub_1800072D0
@@ -453,23 +1186,20 @@ __int64 StaticFindObject(const char* name)
     unsigned char type = *reinterpret_cast<unsigned char*>(patternLink);
     __int64 gobjectsBase = *reinterpret_cast<__int64*>(patternLink + 8);
 
-    __int64 result = 0;
+    // Objects created after the index was built are only found by a sweep
+    __int64 result = ObjectIndex::Find(name);
 
-    if (type == 1)
+    if (!result && type == 1)
     {
         result = FindObjectType1(gobjectsBase, name);
     }
-    else if (type == 2)
+    else if (!result && type == 2)
     {
         result = FindObjectType2(gobjectsBase, name);
     }
 
     if (!result)
-    {
-        MessageBoxA(nullptr,
-            "Value is NULL, please report the game version to Rift developers.",
-            "Error", MB_ICONERROR);
-    }
+        ReportNullValue();
 
     return result;
 }
@@ -480,6 +1210,10 @@ __int64 StaticFindObject(const char* name)
 // On failure, shows MessageBoxA error.
 int FindPropertyOffset(const char* className, const char* propertyName)
 {
+    int cached;
+    if (LookupCachedOffset(className, propertyName, cached))
+        return cached;
+
     __int64 patternLink = Globals::qword_18004FDF0;
     if (!patternLink)
         return 0;
@@ -489,25 +1223,258 @@ int FindPropertyOffset(const char* className, const char* propertyName)
 
     int result = 0;
 
-    if (type == 1)
+    // On object-sweep layouts the property is the object named propertyName
+    // whose Outer is the class, which the index answers directly
+    const VersionFeatures* features = VersionManager::CurrentFeatures();
+    if (type == 1 || !features || features->propertyChain == PropertyChainMode::ObjectSweep)
+    {
+        __int64 prop = ObjectIndex::FindInOuter(className, propertyName);
+        if (prop)
+            result = *reinterpret_cast<int*>(prop + PROP_OFFSET_FIELD);
+    }
+
+    if (!result && type == 1)
     {
         result = FindPropertyType1(gobjectsBase, className, propertyName);
     }
-    else if (type == 2)
+    else if (!result && type == 2)
     {
         result = FindPropertyType2(gobjectsBase, className, propertyName);
     }
 
     if (!result)
+        ReportNullValue();
+    else
     {
-        MessageBoxA(nullptr,
-            "Value is NULL, please report the game version to Rift developers.",
-            "Error", MB_ICONERROR);
+        CacheOffset(className, propertyName, result);
     }
 
     return result;
 }
 
+// ============================================================================
+// Batch lookup
+// ============================================================================
+
+size_t FindBatch(ObjectQuery* objects, size_t objectCount,
+                 PropertyQuery* properties, size_t propertyCount)
+{
+    for (size_t i = 0; i < objectCount; ++i)
+        objects[i].result = 0;
+    for (size_t i = 0; i < propertyCount; ++i)
+    {
+        properties[i].offset = 0;
+        properties[i].found = false;
+    }
+
+    __int64 patternLink = Globals::qword_18004FDF0;
+    if (!patternLink)
+        return objectCount + propertyCount;
+
+    unsigned char type = *reinterpret_cast<unsigned char*>(patternLink);
+    const VersionFeatures* features = VersionManager::CurrentFeatures();
+    bool objectSweep = type == 1 || !features ||
+                       features->propertyChain == PropertyChainMode::ObjectSweep;
+
+    // Pass 1: the index. Only what it can't answer goes into the sweep.
+    std::unordered_map<std::string, std::vector<size_t>> wantedObjects;
+    std::unordered_map<std::string, std::vector<size_t>> wantedProperties;
+    std::unordered_map<std::string, __int64> wantedClasses;
+    size_t remaining = 0;
+
+    for (size_t i = 0; i < objectCount; ++i)
+    {
+        objects[i].result = ObjectIndex::Find(objects[i].name);
+        if (!objects[i].result)
+        {
+            wantedObjects[objects[i].name].push_back(i);
+            ++remaining;
+        }
+    }
+
+    for (size_t i = 0; i < propertyCount; ++i)
+    {
+        PropertyQuery& query = properties[i];
+        if (objectSweep)
+        {
+            __int64 prop = ObjectIndex::FindInOuter(query.className, query.propertyName);
+            if (prop)
+            {
+                query.offset = *reinterpret_cast<int*>(prop + PROP_OFFSET_FIELD);
+                query.found = true;
+                continue;
+            }
+            wantedProperties[query.propertyName].push_back(i);
+            ++remaining;
+        }
+        else
+        {
+            __int64 classObj = ObjectIndex::Find(query.className);
+            if (classObj)
+            {
+                NameTarget target(query.propertyName);
+                query.offset = FindInPropertyChain(classObj, target);
+                query.found = query.offset != 0;
+                continue;
+            }
+            if (wantedClasses.emplace(query.className, 0).second)
+                ++remaining;
+        }
+    }
+
+    // Pass 2: one sweep for everything left, in GObjects order so each
+    // query gets the same object its own sweep would have returned
+    ObjectTable table = ObjectTable::Capture();
+    for (ObjectIterator it(table); remaining && it.Next();)
+    {
+        __int64 obj = it.Object();
+        NameCache::Name nameRef = GetObjectNameRef(obj);
+        const std::string& name = *nameRef;
+
+        auto object = wantedObjects.find(name);
+        if (object != wantedObjects.end())
+        {
+            for (size_t index : object->second)
+                objects[index].result = obj;
+            remaining -= object->second.size();
+            wantedObjects.erase(object);
+        }
+
+        auto cls = wantedClasses.find(name);
+        if (cls != wantedClasses.end() && !cls->second)
+        {
+            cls->second = obj;
+            --remaining;
+        }
+
+        auto prop = wantedProperties.find(name);
+        if (prop != wantedProperties.end())
+        {
+            NameCache::Name outerName = GetObjectNameRef(GetObjectOuter(obj));
+            auto& pending = prop->second;
+            for (size_t k = 0; k < pending.size();)
+            {
+                PropertyQuery& query = properties[pending[k]];
+                if (*outerName != query.className)
+                {
+                    ++k;
+                    continue;
+                }
+                query.offset = *reinterpret_cast<int*>(obj + PROP_OFFSET_FIELD);
+                query.found = true;
+                --remaining;
+                pending[k] = pending.back();
+                pending.pop_back();
+            }
+        }
+    }
+
+    // Property chains of the classes found by the sweep, one walk per query
+    for (size_t i = 0; i < propertyCount && !objectSweep; ++i)
+    {
+        PropertyQuery& query = properties[i];
+        if (query.found)
+            continue;
+        auto cls = wantedClasses.find(query.className);
+        if (cls == wantedClasses.end() || !cls->second)
+            continue;
+        NameTarget target(query.propertyName);
+        query.offset = FindInPropertyChain(cls->second, target);
+        query.found = query.offset != 0;
+    }
+
+    size_t misses = 0;
+    for (size_t i = 0; i < objectCount; ++i)
+        misses += objects[i].result ? 0 : 1;
+    for (size_t i = 0; i < propertyCount; ++i)
+        misses += properties[i].found ? 0 : 1;
+    return misses;
+}
+
+bool TryFindPropertyOffset(const char* className, const char* propertyName, int& offset)
+{
+    if (LookupCachedOffset(className, propertyName, offset))
+        return true;
+
+    PropertyQuery query{className, propertyName, 0, false};
+    FindBatch(nullptr, 0, &query, 1);
+    offset = query.offset;
+    if (query.found)
+        CacheOffset(className, propertyName, offset);
+    return query.found;
+}
+
+// One MessageBoxA listing every miss of a batch, where the single lookups
+// show one box per miss
+static void ReportBatchMisses(const ObjectQuery* objects, size_t objectCount,
+                              const PropertyQuery* properties, size_t propertyCount)
+{
+    if (!g_LookupBoxes.load(std::memory_order_relaxed))
+        return;
+
+    std::string text =
+        "Value is NULL, please report the game version to Rift developers.\n";
+    for (size_t i = 0; i < objectCount; ++i)
+    {
+        if (!objects[i].result)
+            text += std::string("\n") + objects[i].name;
+    }
+    for (size_t i = 0; i < propertyCount; ++i)
+    {
+        if (!properties[i].found)
+            text += std::string("\n") + properties[i].className + "::" +
+                    properties[i].propertyName;
+    }
+    MessageBoxA(nullptr, text.c_str(), "Error", MB_ICONERROR);
+}
+
+// ============================================================================
+// SDK property registry
+// ============================================================================
+//
+// Every property offset the SDK reads, from the Fields descriptors that
+// Prop<> uses. Resolved in one FindBatch (index build + at most one shared
+// sweep) instead of one FindPropertyOffset sweep per entry, into the offset
+// cache that Prop<> reads through; add new offsets here.
+
+struct SdkProperty {
+    const char* className;
+    const char* propertyName;
+};
+
+#define SDK_PROPERTY(Field) {Fields::Field::className, Fields::Field::propertyName}
+
+static constexpr SdkProperty g_SdkProperties[] = {
+    SDK_PROPERTY(World_OwningGameInstance),
+    SDK_PROPERTY(GameInstance_LocalPlayers),
+    SDK_PROPERTY(LocalPlayer_ViewportClient),
+    SDK_PROPERTY(GameViewportClient_ViewportConsole),
+};
+
+#undef SDK_PROPERTY
+
+static constexpr size_t SDK_PROPERTY_COUNT =
+    sizeof(g_SdkProperties) / sizeof(g_SdkProperties[0]);
+
+// Only offsets that were found are cached; a miss is looked up again by
+// the next FindPropertyOffset
+static void ResolveSdkProperties()
+{
+    PropertyQuery queries[SDK_PROPERTY_COUNT];
+    for (size_t i = 0; i < SDK_PROPERTY_COUNT; ++i)
+        queries[i] = PropertyQuery{g_SdkProperties[i].className,
+                                   g_SdkProperties[i].propertyName, 0, false};
+
+    if (FindBatch(nullptr, 0, queries, SDK_PROPERTY_COUNT))
+        ReportBatchMisses(nullptr, 0, queries, SDK_PROPERTY_COUNT);
+
+    for (size_t i = 0; i < SDK_PROPERTY_COUNT; ++i)
+    {
+        if (queries[i].found)
+            CacheOffset(queries[i].className, queries[i].propertyName, queries[i].offset);
+    }
+}
+
 // Original: sub_18000E8A0
 // Initializes console and viewport for the local player.
 // Navigation chain:
@@ -520,16 +1487,36 @@ int FindPropertyOffset(const char* className, const char* propertyName)
 //   7. Assign constructed console to ViewportConsole property on ViewportClient
 unsigned int InitConsoleAndViewport()
 {
-    // Resolve required objects
-    __int64 gameplayStatics = StaticFindObject("Default__GameplayStatics");
-    __int64 consoleObj = StaticFindObject("Console");
-
-    // Find "OwningGameInstance" offset on "World" class
-    int worldOffset = FindPropertyOffset("World", "OwningGameInstance");
+    // Resolve both objects in one batch; the original looks each one up
+    // (and every property offset below) with its own GObjects sweep
+    ObjectQuery objects[] = {
+        {"Default__GameplayStatics", 0},
+        {"Console", 0},
+    };
+    constexpr size_t objectCount = sizeof(objects) / sizeof(objects[0]);
+
+    if (FindBatch(objects, objectCount, nullptr, 0))
+        ReportBatchMisses(objects, objectCount, nullptr, 0);
+
+    __int64 gameplayStatics = objects[0].result;
+    __int64 consoleObj = objects[1].result;
+
+    // Get() on a field that was not found would read (or, for
+    // ViewportConsole, overwrite) the start of the object
+    using OwningGameInstance = Prop<Fields::World_OwningGameInstance>;
+    using LocalPlayers = Prop<Fields::GameInstance_LocalPlayers>;
+    using ViewportClient = Prop<Fields::LocalPlayer_ViewportClient>;
+    using ViewportConsole = Prop<Fields::GameViewportClient_ViewportConsole>;
+    if (!OwningGameInstance::Resolved() || !LocalPlayers::Resolved() ||
+        !ViewportClient::Resolved() || !ViewportConsole::Resolved())
+    {
+        return MessageBoxA(nullptr, "A viewport property offset was not found.",
+                           "Error", MB_ICONERROR);
+    }
 
-    // Navigate: *GWorld -> [OwningGameInstance offset]
-    __int64 owningGameInstance = *reinterpret_cast<__int64*>(
-        worldOffset + *reinterpret_cast<__int64*>(Globals::qword_18004FDB0));
+    // Navigate: *GWorld -> OwningGameInstance
+    __int64 world = *reinterpret_cast<__int64*>(Globals::qword_18004FDB0);
+    __int64 owningGameInstance = OwningGameInstance::Get(world);
 
     if (!owningGameInstance)
     {
@@ -538,9 +1525,7 @@ unsigned int InitConsoleAndViewport()
     }
 
     // Navigate: GameInstance -> LocalPlayers[0]
-    int localPlayersOffset = FindPropertyOffset("GameInstance", "LocalPlayers");
-    __int64 localPlayer = **reinterpret_cast<__int64**>(
-        localPlayersOffset + owningGameInstance);
+    __int64 localPlayer = LocalPlayers::Get(owningGameInstance)[0];
 
     if (!localPlayer)
     {
@@ -549,9 +1534,7 @@ unsigned int InitConsoleAndViewport()
     }
 
     // Navigate: LocalPlayer -> ViewportClient
-    int viewportClientOffset = FindPropertyOffset("LocalPlayer", "ViewportClient");
-    __int64 viewportClient = *reinterpret_cast<__int64*>(
-        viewportClientOffset + localPlayer);
+    __int64 viewportClient = ViewportClient::Get(localPlayer);
 
     if (!viewportClient)
     {
@@ -561,12 +1544,12 @@ unsigned int InitConsoleAndViewport()
 
     // Call ProcessEvent to construct console
     // Original: qword_18004FDE8(gameplayStatics, qword_18004FFF0, params, 0)
-    __int64 params[2] = { consoleObj, static_cast<__int64>(viewportClient) };
-    Globals::qword_18004FDE8(gameplayStatics, Globals::qword_18004FFF0,
-                              reinterpret_cast<__int64>(params), 0);
-
-    // Get the constructed console from the result
-    __int64 constructedConsole = params[1];  // output parameter
+    // with params = { Console class, ViewportClient }; qword_18004FFF0 is
+    // GameplayStatics:SpawnObject(ObjectClass, Outer), which this handle
+    // resolves by name and lays out from its parameters
+    static FunctionHandle spawnObject("GameplayStatics:SpawnObject");
+    __int64 constructedConsole =
+        spawnObject.Call<__int64>(gameplayStatics, consoleObj, viewportClient);
 
     if (!constructedConsole)
     {
@@ -575,12 +1558,9 @@ unsigned int InitConsoleAndViewport()
     }
 
     // Assign to ViewportConsole property
-    int viewportConsoleOffset = FindPropertyOffset(
-        "GameViewportClient", "ViewportConsole");
-    *reinterpret_cast<__int64*>(viewportConsoleOffset + viewportClient) =
-        constructedConsole;
+    ViewportConsole::Get(viewportClient) = constructedConsole;
 
-    return static_cast<unsigned int>(viewportConsoleOffset);
+    return static_cast<unsigned int>(ViewportConsole::TryOffset());
 }
 
 // Original: sub_180007CB0
@@ -593,6 +1573,13 @@ void InitializeSDK()
     // The implementation is a large function with many FindPropertyOffset
     // calls that build up the internal state needed for game interaction.
     // Full reconstruction requires mapping all property offset globals.
+
+    // Here every offset in g_SdkProperties is resolved in one pass: the
+    // GObjects index is built in a single sweep, the registry is answered
+    // from it (anything it misses shares one more sweep), and the results
+    // land in the offset cache
+    ObjectIndex::Build();
+    ResolveSdkProperties();
 }
 
 } // namespace UE4
@@ -12,88 +12,34 @@
  * version range, and a std::vector<PatternEntry> of 5 pattern entries.
  *
  * This file contains all 9 version configurations extracted from the binary.
- * InputKey patterns are stored encrypted and decrypted at runtime.
+ * InputKey patterns are stored encrypted (see encrypted_blobs.cpp) and are
+ * compiled from the startup-decrypted arena.
  */
 
 #include "version_config.h"
 #include "pattern_scan.h"
+#include "encrypted_blobs.h"
+#include "signature_db.h"
+#include "thread_pool.h"
+#include "telemetry.h"
+#include "startup_arena.h"
+#include "safe_memory.h"
+#include <emmintrin.h>  // SSE2
 #include <cstring>
 #include <cstdlib>
-
-// ============================================================================
-// Encrypted InputKey pattern blobs (stored in .rdata in original)
-// Decryption: XOR each byte with ((index % 51) + 52)
-// The SSE2 vectorized decryption in the original is functionally equivalent.
-// ============================================================================
-
-// Blob 1: 87 bytes (configs 1) - from xmmword_180046930..180046970 + "qbctabW"
-static const unsigned char g_InputKeyBlob1[87] = {
-    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
-    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
-    0x7C, 0x65, 0x76, 0x7F, 0x68, 0x7D, 0x72, 0x6B,
-    0x74, 0x74, 0x6E, 0x79, 0x68, 0x71, 0x63, 0x63,
-    0x74, 0x61, 0x6E, 0x77, 0x60, 0x60, 0x7A, 0x6C,
-    0x6C, 0x7D, 0x6F, 0x67, 0x40, 0x55, 0x5A, 0x43,
-    0x5C, 0x5C, 0x46, 0x03, 0x0D, 0x16, 0x05, 0x08,
-    0x19, 0x0E, 0x0A, 0x1C, 0x08, 0x08, 0x1F, 0x74,
-    0x79, 0x62, 0x7B, 0x75, 0x65, 0x03, 0x04, 0x68,
-    0x0F, 0x7A, 0x6B, 0x7C, 0x7D, 0x6E, 0x7F, 0x60,
-    0x71, 0x62, 0x63, 0x74, 0x61, 0x62, 0x57
-};
-
-// Blob 2: 75 bytes (configs 2-6) - from xmmword_1800468B0 + string constants
-static const unsigned char g_InputKeyBlob2[75] = {
-    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
-    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
-    0x7C, 0x65, 0x77, 0x77, 0x68, 0x7D, 0x72, 0x6B,
-    0x74, 0x74, 0x6E, 0x78, 0x60, 0x71, 0x63, 0x6B,
-    0x74, 0x61, 0x6E, 0x77, 0x60, 0x60, 0x7A, 0x6C,
-    0x64, 0x7D, 0x6C, 0x6F, 0x40, 0x55, 0x53, 0x43,
-    0x51, 0x53, 0x46, 0x00, 0x0D, 0x16, 0x0F, 0x09,
-    0x19, 0x7F, 0x78, 0x1C, 0x7B, 0x0E, 0x1F, 0x70,
-    0x71, 0x62, 0x73, 0x74, 0x65, 0x76, 0x77, 0x68,
-    0x7D, 0x7E, 0x4B
-};
-
-// Blob 3: 82 bytes (config 7) - from xmmword_180046DC0 + mixed constants
-static const unsigned char g_InputKeyBlob3[82] = {
-    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
-    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
-    0x7C, 0x65, 0x77, 0x77, 0x68, 0x7D, 0x72, 0x6B,
-    0x74, 0x74, 0x6E, 0x78, 0x68, 0x71, 0x63, 0x6B,
-    0x74, 0x60, 0x63, 0x77, 0x6C, 0x68, 0x7A, 0x6E,
-    0x6A, 0x7D, 0x6A, 0x6E, 0x40, 0x54, 0x55, 0x43,
-    0x50, 0x5D, 0x46, 0x0C, 0x71, 0x16, 0x01, 0x00,
-    0x19, 0x05, 0x1B, 0x08, 0x05, 0x1E, 0x07, 0x71,
-    0x61, 0x07, 0x00, 0x64, 0x7A, 0x66, 0x78, 0x68,
-    0x76, 0x6A, 0x74, 0x6C, 0x79, 0x7A, 0x6F, 0x60,
-    0x17, 0x52
-};
-
-// Blob 4: 78 bytes (configs 8-9) - from xmmword_1800464D0..180046500 + int constants
-static const unsigned char g_InputKeyBlob4[78] = {
-    0x00, 0x0D, 0x16, 0x0F, 0x7A, 0x19, 0x79, 0x0F,
-    0x1C, 0x09, 0x06, 0x1F, 0x78, 0x78, 0x62, 0x76,
-    0x7C, 0x65, 0x77, 0x77, 0x68, 0x7D, 0x72, 0x6B,
-    0x74, 0x74, 0x6E, 0x70, 0x70, 0x60, 0x6A, 0x73,
-    0x61, 0x60, 0x76, 0x62, 0x6F, 0x79, 0x6E, 0x6A,
-    0x7C, 0x68, 0x69, 0x7F, 0x54, 0x59, 0x42, 0x5B,
-    0x20, 0x45, 0x50, 0x0C, 0x15, 0x09, 0x17, 0x0C,
-    0x01, 0x1A, 0x03, 0x0D, 0x1D, 0x7B, 0x7C, 0x60,
-    0x7E, 0x62, 0x7C, 0x64, 0x7A, 0x66, 0x78, 0x68,
-    0x7D, 0x7E, 0x6B, 0x7C, 0x0B, 0x4E
+#include <new>
+
+// Source row for one built-in PatternEntry. Encrypted entries have no
+// plaintext: `pattern` is null and the pattern is compiled straight from
+// the decrypted blob arena instead.
+struct PatternSpec {
+    const char* name;
+    const char* pattern;
+    int offset_a;
+    int offset_b;
+    EncryptedBlobs::BlobId blob = EncryptedBlobs::BlobId::Count;
 };
 
-// Decrypt an encrypted pattern blob in-place: XOR with ((i % 51) + 52)
-static std::string DecryptInputKeyBlob(const unsigned char* blob, size_t size)
-{
-    std::string result(reinterpret_cast<const char*>(blob), size);
-    for (size_t i = 0; i < size; i++)
-        result[i] ^= static_cast<char>((i % 51) + 52);
-    // The decrypted result is a null-terminated pattern string
-    return std::string(result.c_str());
-}
-
 // ============================================================================
 // Pattern string constants (from .rdata section)
 // ============================================================================
@@ -149,8 +95,124 @@ static const char* PAT_GWORLD_V5 =
 
 // ============================================================================
 // Version config storage (equivalent to std::map in original)
+// Lives in the startup arena; null before InitVersionConfigs and after
+// ResolveDeferredPatterns has released the arena.
+// ============================================================================
+static std::pmr::vector<VersionConfig>* g_VersionConfigs = nullptr;
+
 // ============================================================================
-static std::vector<VersionConfig> g_VersionConfigs;
+// Version interval table
+//
+// Sorted, disjoint CL ranges mapped to their feature descriptor. This folds
+// the config ranges of sub_180001020 together with the range checks the
+// original scatters through sub_180027620 and sub_1800282B0:
+//   (unsigned)(v - 4204761) <= 0x2679    -> 4204761 - 4214610  (Flat24)
+//   (unsigned)(v - 4225813) <= 0x397C8   -> 4225813 - 4461277  (Chunked32)
+//   v < 4464155                          -> Chunked16 otherwise
+//   (unsigned)(v - 5914491) <= 0x87618A  -> 5914491 - 14786821 (byte patches)
+//   v == 3700114                         -> RET stub
+//   v >= 11794982                        -> PropertyLink walk
+// Only CLs covered by a version config are listed; anything else is
+// unsupported and InitializePatterns stops before the other checks matter.
+// ============================================================================
+using GL = GObjectsLayout;
+using PC = PropertyChainMode;
+
+static constexpr VersionInterval g_VersionTable[] = {
+    // min       max        set  GObjects        property chain     patches
+    {3700114,  3700114,  {0, GL::Chunked16, PC::ObjectSweep,  PATCH_RET_STUB}},
+    {3700115,  3785438,  {0, GL::Chunked16, PC::ObjectSweep,  PATCH_NONE}},
+    {3790078,  3876086,  {1, GL::Chunked16, PC::ObjectSweep,  PATCH_NONE}},
+    {3889387,  4166199,  {2, GL::Chunked16, PC::ObjectSweep,  PATCH_NONE}},
+    {4204761,  4214610,  {3, GL::Flat24,    PC::ObjectSweep,  PATCH_NONE}},
+    {4214611,  4225812,  {3, GL::Chunked16, PC::ObjectSweep,  PATCH_NONE}},
+    {4225813,  4461277,  {3, GL::Chunked32, PC::ObjectSweep,  PATCH_NONE}},
+    {4464155,  5285981,  {4, GL::None,      PC::ObjectSweep,  PATCH_NONE}},
+    {5362200,  5914490,  {5, GL::None,      PC::ObjectSweep,  PATCH_NONE}},
+    {5914491,  11586896, {5, GL::None,      PC::ObjectSweep,  PATCH_BYTE_FLAGS}},
+    {11794982, 13498980, {6, GL::None,      PC::PropertyLink, PATCH_BYTE_FLAGS}},
+    {13649278, 14786821, {7, GL::None,      PC::PropertyLink, PATCH_BYTE_FLAGS}},
+    {14786822, 15570449, {7, GL::None,      PC::PropertyLink, PATCH_NONE}},
+    {15685441, 15727376, {8, GL::None,      PC::PropertyLink, PATCH_NONE}},
+};
+
+static constexpr size_t VERSION_TABLE_SIZE =
+    sizeof(g_VersionTable) / sizeof(g_VersionTable[0]);
+
+static constexpr bool IsSortedAndDisjoint()
+{
+    for (size_t i = 0; i < VERSION_TABLE_SIZE; ++i)
+    {
+        if (g_VersionTable[i].version_min > g_VersionTable[i].version_max)
+            return false;
+        if (i && g_VersionTable[i - 1].version_max >= g_VersionTable[i].version_min)
+            return false;
+    }
+    return true;
+}
+
+static_assert(IsSortedAndDisjoint(), "version table must be sorted and disjoint");
+
+const VersionFeatures* VersionManager::SearchIntervals(const VersionInterval* table,
+                                                      size_t count, int engineVersion)
+{
+    if (!count)
+        return nullptr;
+
+    // Branch-free lower bound: the loop trip count depends only on the
+    // table size, and the step is a conditional move.
+    const VersionInterval* base = table;
+    size_t n = count;
+    while (n > 1)
+    {
+        size_t half = n / 2;
+        base = (base[half].version_min <= engineVersion) ? base + half : base;
+        n -= half;
+    }
+
+    if (engineVersion < base->version_min || engineVersion > base->version_max)
+        return nullptr;
+    return &base->features;
+}
+
+const VersionFeatures* VersionManager::FindVersionFeatures(int engineVersion)
+{
+    if (SignatureDB::IsLoaded())
+        return SignatureDB::FindVersionFeatures(engineVersion);
+    return SearchIntervals(g_VersionTable, VERSION_TABLE_SIZE, engineVersion);
+}
+
+const VersionInterval* VersionManager::BuiltinIntervals(size_t& count)
+{
+    count = VERSION_TABLE_SIZE;
+    return g_VersionTable;
+}
+
+const VersionFeatures* VersionManager::CurrentFeatures()
+{
+    return FindVersionFeatures(Globals::dword_18004FDE0);
+}
+
+// Append one built-in config to g_VersionConfigs, compiling every pattern
+// once. Everything (entries, strings) is allocated from the startup arena.
+static void AddConfig(int versionMin, int versionMax,
+                      std::initializer_list<PatternSpec> specs)
+{
+    VersionConfig& cfg = g_VersionConfigs->emplace_back();
+    cfg.version_min = versionMin;
+    cfg.version_max = versionMax;
+    cfg.patterns.reserve(specs.size());
+
+    for (const PatternSpec& spec : specs)
+    {
+        PatternEntry& entry = cfg.patterns.emplace_back(
+            spec.name, spec.pattern ? spec.pattern : "", spec.offset_a, spec.offset_b);
+        if (spec.pattern)
+            PatternScan::CompilePattern(entry.pattern.c_str(), entry.compiled);
+        else
+            PatternScan::CompilePattern(EncryptedBlobs::Get(spec.blob), entry.compiled);
+    }
+}
 
 // ============================================================================
 // InitVersionConfigs - equivalent to sub_180001020
@@ -160,210 +222,349 @@ static std::vector<VersionConfig> g_VersionConfigs;
 // ============================================================================
 void VersionManager::InitVersionConfigs()
 {
-    g_VersionConfigs.clear();
-    g_VersionConfigs.reserve(9);
-
-    // Decrypt InputKey blobs
-    std::string inputkey1 = DecryptInputKeyBlob(g_InputKeyBlob1, sizeof(g_InputKeyBlob1));
-    std::string inputkey2 = DecryptInputKeyBlob(g_InputKeyBlob2, sizeof(g_InputKeyBlob2));
-    std::string inputkey3 = DecryptInputKeyBlob(g_InputKeyBlob3, sizeof(g_InputKeyBlob3));
-    std::string inputkey4 = DecryptInputKeyBlob(g_InputKeyBlob4, sizeof(g_InputKeyBlob4));
+    // A mapped signature database replaces the built-in configs entirely
+    if (SignatureDB::IsLoaded() || g_VersionConfigs)
+        return;
+
+    std::pmr::memory_resource* arena = StartupArena::Resource();
+    void* storage = arena->allocate(sizeof(std::pmr::vector<VersionConfig>),
+                                    alignof(std::pmr::vector<VersionConfig>));
+    g_VersionConfigs = new (storage) std::pmr::vector<VersionConfig>(arena);
+    g_VersionConfigs->reserve(9);
+
+    // InputKey patterns are compiled from the decrypted blob arena
+    const PatternSpec inputkey1{"InputKey", nullptr, 0, 0, EncryptedBlobs::BlobId::InputKey1};
+    const PatternSpec inputkey2{"InputKey", nullptr, 0, 0, EncryptedBlobs::BlobId::InputKey2};
+    const PatternSpec inputkey3{"InputKey", nullptr, 0, 0, EncryptedBlobs::BlobId::InputKey3};
+    const PatternSpec inputkey4{"InputKey", nullptr, 0, 0, EncryptedBlobs::BlobId::InputKey4};
 
     // Config 1: CL 3700114 - 3785438
-    {
-        VersionConfig cfg;
-        cfg.version_min = 3700114;
-        cfg.version_max = 3785438;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V1,     3, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V1,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V1,        3, 0},
-            {"InputKey",     inputkey1,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(3700114, 3785438, {
+        {"GObjects",     PAT_GOBJECTS_V1,     3, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V1,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V1,        3, 0},
+        inputkey1,
+    });
 
     // Config 2: CL 3790078 - 3876086
-    {
-        VersionConfig cfg;
-        cfg.version_min = 3790078;
-        cfg.version_max = 3876086;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V1,     3, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V1,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V1,        3, 0},
-            {"InputKey",     inputkey2,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(3790078, 3876086, {
+        {"GObjects",     PAT_GOBJECTS_V1,     3, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V1,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V1,        3, 0},
+        inputkey2,
+    });
 
     // Config 3: CL 3889387 - 4166199
-    {
-        VersionConfig cfg;
-        cfg.version_min = 3889387;
-        cfg.version_max = 4166199;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V1,     3, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V1,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V1,        3, 0},
-            {"InputKey",     inputkey2,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(3889387, 4166199, {
+        {"GObjects",     PAT_GOBJECTS_V1,     3, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V1,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V1,        3, 0},
+        inputkey2,
+    });
 
     // Config 4: CL 4204761 - 4461277
-    {
-        VersionConfig cfg;
-        cfg.version_min = 4204761;
-        cfg.version_max = 4461277;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V2,     3, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V2, 12, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V2,        3, 0},
-            {"InputKey",     inputkey2,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(4204761, 4461277, {
+        {"GObjects",     PAT_GOBJECTS_V2,     3, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V2, 12, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V2,        3, 0},
+        inputkey2,
+    });
 
     // Config 5: CL 4464155 - 5285981
-    {
-        VersionConfig cfg;
-        cfg.version_min = 4464155;
-        cfg.version_max = 5285981;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V3,        3, 0},
-            {"InputKey",     inputkey2,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(4464155, 5285981, {
+        {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V3,        3, 0},
+        inputkey2,
+    });
 
     // Config 6: CL 5362200 - 11586896
-    {
-        VersionConfig cfg;
-        cfg.version_min = 5362200;
-        cfg.version_max = 11586896;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V4,        3, 0},
-            {"InputKey",     inputkey2,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(5362200, 11586896, {
+        {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V4,        3, 0},
+        inputkey2,
+    });
 
     // Config 7: CL 11794982 - 13498980
-    {
-        VersionConfig cfg;
-        cfg.version_min = 11794982;
-        cfg.version_max = 13498980;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V4,        3, 0},
-            {"InputKey",     inputkey3,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(11794982, 13498980, {
+        {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V4,        3, 0},
+        inputkey3,
+    });
 
     // Config 8: CL 13649278 - 15570449
-    {
-        VersionConfig cfg;
-        cfg.version_min = 13649278;
-        cfg.version_max = 15570449;
-        cfg.patterns = {
-            {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
-            {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V4,        3, 0},
-            {"InputKey",     inputkey4,             0, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(13649278, 15570449, {
+        {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
+        {"ProcessEvent", PAT_PROCESSEVENT_V3,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V4,        3, 0},
+        inputkey4,
+    });
 
     // Config 9: CL 15685441 - 15727376
     // Note: different order and different patterns for ProcessEvent and GWorld
-    {
-        VersionConfig cfg;
-        cfg.version_min = 15685441;
-        cfg.version_max = 15727376;
-        cfg.patterns = {
-            {"ProcessEvent", PAT_PROCESSEVENT_V4,  0, 0},
-            {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
-            {"GWorld",       PAT_GWORLD_V5,        0, 0},
-            {"InputKey",     inputkey4,             0, 0},
-            {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
-        };
-        g_VersionConfigs.push_back(std::move(cfg));
-    }
+    AddConfig(15685441, 15727376, {
+        {"ProcessEvent", PAT_PROCESSEVENT_V4,  0, 0},
+        {"FNameToString",PAT_FNAMETOSTRING,   19, 0},
+        {"GWorld",       PAT_GWORLD_V5,        0, 0},
+        inputkey4,
+        {"GObjects",     PAT_GOBJECTS_V3,    10, 0},
+    });
 }
 
 // ============================================================================
-// Helper: find PatternEntry by name in a VersionConfig's pattern list
+// Helper: find a pattern by name in the active pattern set
 // Equivalent to sub_180027260 (PatternLink resolver)
-// Returns pointer to the matching PatternEntry, or nullptr if not found.
+// Reads from the signature database when loaded, otherwise from the
+// built-in VersionConfig. Returns false if the pattern is not found.
 // In the original, failure triggers MessageBoxA("Failed to find PatternLink").
 // ============================================================================
-static const PatternEntry* FindPatternByName(const VersionConfig& config,
-                                              const char* name)
+bool VersionManager::FindBuiltinPattern(int patternSet, std::string_view name,
+                                        SignatureDB::PatternRef& out)
 {
-    for (const auto& entry : config.patterns)
+    if (!g_VersionConfigs || patternSet < 0 ||
+        static_cast<size_t>(patternSet) >= g_VersionConfigs->size())
+        return false;
+
+    for (const auto& entry : (*g_VersionConfigs)[patternSet].patterns)
     {
-        if (entry.name == name)
-            return &entry;
+        if (entry.name != name)
+            continue;
+
+        out.name = entry.name;
+        out.signatures[0] = SignatureDB::Signature{
+            PatternScan::ViewOf(entry.compiled), entry.offset_a, entry.offset_b};
+        out.count = 1;
+        for (const auto& alt : entry.alternatives)
+        {
+            if (out.count == PatternScan::kMaxAlternatives)
+                break;
+            out.signatures[out.count++] = SignatureDB::Signature{
+                PatternScan::ViewOf(alt.compiled), alt.offset_a, alt.offset_b};
+        }
+        return true;
     }
+    return false;
+}
+
+static bool FindPatternByName(int patternSet, const char* name,
+                              SignatureDB::PatternRef& out)
+{
+    bool found = SignatureDB::IsLoaded()
+        ? SignatureDB::FindPattern(patternSet, name, out)
+        : VersionManager::FindBuiltinPattern(patternSet, name, out);
+    if (found)
+        return true;
+
     MessageBoxA(nullptr, "Failed to find PatternLink", "Error", MB_ICONERROR);
-    return nullptr;
+    return false;
 }
 
 // ============================================================================
 // Helper: scan for pattern and resolve address
 // Matches the inline pattern scan + RIP resolution in sub_180027620
 // ============================================================================
-static __int64 ScanAndResolve(HMODULE module, const PatternEntry* entry)
+static __int64 ScanAndResolve(HMODULE module, const SignatureDB::PatternRef* entry,
+                              int patternSet)
 {
     if (!entry)
         return 0;
 
-    auto pattern = PatternScan::ParsePattern(entry->pattern.c_str());
-    uintptr_t addr = PatternScan::FindPatternRaw(module, pattern);
+    // All signatures of the symbol are tried in one sweep; the
+    // highest-priority one that matches supplies the resolver offsets
+    PatternScan::PatternView views[PatternScan::kMaxAlternatives];
+    for (int i = 0; i < entry->count; ++i)
+        views[i] = entry->signatures[i].pattern;
+
+    PatternScan::ScanStats stats;
+    uintptr_t addr;
+    int winner = PatternScan::FindFirstOfCompiled(module, views, entry->count, addr,
+                                                  stats, Telemetry::ExhaustiveScans());
 
     if (!addr)
     {
+        Telemetry::RecordScan(entry->name, patternSet, stats, 0, module);
         MessageBoxA(nullptr,
             "Rift cannot start due to a pattern mismatch. Please try another version.",
             "Error", MB_ICONERROR);
         return 0;
     }
 
+    const SignatureDB::Signature& sig = entry->signatures[winner];
     __int64 result = static_cast<__int64>(addr);
 
     // Apply RIP-relative resolution
-    if (entry->offset_a)
-        result = result + entry->offset_a +
-                 *reinterpret_cast<int*>(result + entry->offset_a) + 4;
+    if (sig.offset_a)
+        result = result + sig.offset_a +
+                 *reinterpret_cast<int*>(result + sig.offset_a) + 4;
 
     // Apply additional offset
-    if (entry->offset_b)
-        result += entry->offset_b;
+    if (sig.offset_b)
+        result += sig.offset_b;
 
+    Telemetry::RecordScan(entry->name, patternSet, stats,
+                          static_cast<uintptr_t>(result), module);
     return result;
 }
 
+// ============================================================================
+// Lazy pattern handles, one per PatternId
+// ============================================================================
+static PatternScan::LazyPattern g_Patterns[static_cast<int>(PatternId::Count)];
+
+// Startup pool tasks resolving g_Patterns, joined by ResolveDeferredPatterns.
+// InputKey has none: ResolveDeferredPatterns prefetches it afterwards.
+static std::future<__int64> g_PatternTasks[static_cast<int>(PatternId::Count)];
+
+// Signatures each resolver scans. The built-in configs live in the startup
+// arena, which ResolveDeferredPatterns releases before InputKey is first
+// used, so every resolver works on its own copy.
+static PatternScan::CompiledPattern
+    g_PatternCopies[static_cast<int>(PatternId::Count)][PatternScan::kMaxAlternatives];
+
+static void CopySignatures(SignatureDB::PatternRef& ref, const char* name,
+                           PatternScan::CompiledPattern* storage)
+{
+    ref.name = name;
+    for (int i = 0; i < ref.count; ++i)
+    {
+        const PatternScan::PatternView& view = ref.signatures[i].pattern;
+        storage[i].size = view.size;
+        memcpy(storage[i].bytes, view.bytes, view.size);
+        memcpy(storage[i].mask, view.mask, view.size);
+        ref.signatures[i].pattern = PatternScan::ViewOf(storage[i]);
+    }
+}
+
+PatternScan::LazyPattern& VersionManager::GetPattern(PatternId id)
+{
+    return g_Patterns[static_cast<int>(id)];
+}
+
+// ============================================================================
+// Helper: GObjects adjustment and PatternLink creation
+// Tail of sub_180027620; runs as part of resolving the GObjects handle.
+//
+// The original has one inlined copy of the sentinel loop per layout, each
+// stepping a byte at a time from the resolved address looking for an int32
+// equal to -1 within 2048 bytes, then backing off by a fixed amount. Here
+// the layouts are rows of g_GObjectsFixups and share one SSE2 search.
+// ============================================================================
+static constexpr size_t GOBJECTS_SENTINEL_WINDOW = 2048;
+
+struct GObjectsFixup {
+    GObjectsLayout layout;
+    unsigned char patternLinkType;  // PatternLink +0: 1 = flat, 2 = chunked
+    int backoff;                    // bytes subtracted from the sentinel address
+};
+
+static constexpr GObjectsFixup g_GObjectsFixups[] = {
+    {GObjectsLayout::Flat24,    1, 24},   // 4204761 - 4214610
+    {GObjectsLayout::Chunked32, 2, 32},   // 4225813 - 4461277
+    {GObjectsLayout::Chunked16, 2, 16},   // all other versions < 4464155
+};
+
+// First byte offset in [0, window) at which an unaligned int32 reads -1,
+// or -1 if there is none. Reads exactly [base, base + window + 3).
+static int FindInt32Sentinel(const unsigned char* base, size_t window)
+{
+    const __m128i ones = _mm_set1_epi8(-1);
+    size_t i = 0;
+
+    // Lane k of the AND of four loads shifted by 0..3 is 0xFF only if
+    // bytes k..k+3 are all 0xFF, i.e. the int32 at offset i + k is -1
+    for (; i + 16 <= window; i += 16)
+    {
+        const unsigned char* p = base + i;
+        __m128i all = _mm_and_si128(
+            _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+                          _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 1))),
+            _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2)),
+                          _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 3))));
+
+        unsigned mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(all, ones)));
+        if (mask)
+        {
+            int lane = 0;
+            while (!(mask & 1))
+            {
+                mask >>= 1;
+                ++lane;
+            }
+            return static_cast<int>(i) + lane;
+        }
+    }
+
+    for (; i < window; ++i)
+    {
+        int value;
+        memcpy(&value, base + i, sizeof(value));
+        if (value == -1)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+static __int64 AdjustGObjects(const VersionFeatures* features, __int64 gobjects)
+{
+    if (!gobjects)
+        return 0;
+
+    const GObjectsFixup* fixup = nullptr;
+    for (const auto& row : g_GObjectsFixups)
+    {
+        if (row.layout == features->gobjectsLayout)
+            fixup = &row;
+    }
+
+    // Versions >= 4464155 don't need GObjects adjustment
+    if (!fixup)
+        return gobjects;
+
+    // The original walks off the end of the window and uses whatever it
+    // stopped on; treat a missing sentinel (or unreadable window) as a
+    // failed resolution instead. The window is copied out under SEH so a
+    // page released by another thread meanwhile fails the copy instead of
+    // faulting the search.
+    unsigned char window[GOBJECTS_SENTINEL_WINDOW + 3];
+    if (!SafeMemory::Read(reinterpret_cast<const void*>(gobjects), window, sizeof(window)))
+        return 0;
+
+    int sentinel = FindInt32Sentinel(window, GOBJECTS_SENTINEL_WINDOW);
+    if (sentinel < 0)
+        return 0;
+
+    __int64 adjusted = gobjects + sentinel - fixup->backoff;
+
+    // Create PatternLink structure (0x10 bytes)
+    auto* plink = reinterpret_cast<__int64*>(operator new(0x10));
+    plink[0] = 0;
+    *reinterpret_cast<unsigned char*>(plink) = fixup->patternLinkType;
+    plink[1] = adjusted;
+    InterlockedExchange64(reinterpret_cast<volatile LONG64*>(&Globals::qword_18004FDF0),
+                          reinterpret_cast<__int64>(plink));
+
+    return adjusted;
+}
+
 // ============================================================================
 // InitializePatterns - Original: sub_180027620
 //
-// Finds the matching version config, resolves all 5 patterns, stores
-// resolved addresses in globals, then performs version-specific GObjects
-// adjustments to create PatternLink structures.
+// Finds the matching version config, binds a lazy handle to each of the 5
+// patterns and resolves the four MainGameSetup needs concurrently on the
+// startup thread pool. Only GWorld is waited for here because StartAddress
+// polls it next; the rest are joined (and validated) by
+// ResolveDeferredPatterns. InputKey is left to its first Get().
 // ============================================================================
 int VersionManager::InitializePatterns()
 {
@@ -376,173 +577,136 @@ int VersionManager::InitializePatterns()
     }
 
     // Find matching version config
-    const VersionConfig* config = nullptr;
-    for (const auto& cfg : g_VersionConfigs)
-    {
-        if (v0 >= cfg.version_min && v0 <= cfg.version_max)
-        {
-            config = &cfg;
-            break;
-        }
-    }
+    const VersionFeatures* features = FindVersionFeatures(v0);
+    bool supported = features && features->patternSet >= 0 &&
+        (SignatureDB::IsLoaded() ||
+         (g_VersionConfigs &&
+          features->patternSet < static_cast<int>(g_VersionConfigs->size())));
 
-    if (!config)
+    if (!supported)
     {
         return (int)(intptr_t)MessageBoxA(nullptr, "Unsupported version!",
                                           "Error", MB_ICONERROR);
     }
 
-    // Resolve all 5 patterns
-    const PatternEntry* gobjects_entry = FindPatternByName(*config, "GObjects");
-    const PatternEntry* pe_entry = FindPatternByName(*config, "ProcessEvent");
-    const PatternEntry* fnts_entry = FindPatternByName(*config, "FNameToString");
-    const PatternEntry* gw_entry = FindPatternByName(*config, "GWorld");
-    const PatternEntry* ik_entry = FindPatternByName(*config, "InputKey");
+    // Look up all 5 patterns now so a missing entry is reported before any
+    // scan starts
+    static const char* const kNames[] = {
+        "GObjects", "ProcessEvent", "FNameToString", "GWorld", "InputKey",
+    };
+    static __int64* const kPublish[] = {
+        nullptr,    // GObjects: published after adjustment
+        nullptr,    // ProcessEvent: function pointer, published below
+        &Globals::qword_18004FDC8,
+        &Globals::qword_18004FDB0,
+        &Globals::qword_18004FDA8,
+    };
 
     HMODULE gameModule = GetModuleHandleW(nullptr);
+    const int set = features->patternSet;
+
+    for (int i = 0; i < static_cast<int>(PatternId::Count); ++i)
+    {
+        SignatureDB::PatternRef ref;
+        bool found = FindPatternByName(set, kNames[i], ref);
+        PatternScan::LazyPattern::Resolver resolver;
+        if (found)
+            CopySignatures(ref, kNames[i], g_PatternCopies[i]);
+
+        if (!found)
+            resolver = []() -> __int64 { return 0; };
+        else if (i == static_cast<int>(PatternId::GObjects))
+            resolver = [gameModule, ref, set, features]() {
+                __int64 gobjects = AdjustGObjects(features, ScanAndResolve(gameModule, &ref, set));
+                InterlockedExchange64(
+                    reinterpret_cast<volatile LONG64*>(&Globals::qword_18004FDD8), gobjects);
+                return gobjects;
+            };
+        else if (i == static_cast<int>(PatternId::ProcessEvent))
+            resolver = [gameModule, ref, set]() {
+                __int64 processEvent = ScanAndResolve(gameModule, &ref, set);
+                InterlockedExchangePointer(
+                    reinterpret_cast<void* volatile*>(&Globals::qword_18004FDE8),
+                    reinterpret_cast<void*>(processEvent));
+                return processEvent;
+            };
+        else if (i == static_cast<int>(PatternId::InputKey))
+            resolver = [gameModule, ref, set]() {
+                // Checked here rather than in ResolveDeferredPatterns,
+                // which no longer waits for InputKey
+                __int64 inputKey = ScanAndResolve(gameModule, &ref, set);
+                if (!inputKey)
+                    MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
+                return inputKey;
+            };
+        else
+            resolver = [gameModule, ref, set]() { return ScanAndResolve(gameModule, &ref, set); };
+
+        g_Patterns[i].Bind(kNames[i], std::move(resolver), kPublish[i]);
+    }
 
-    // Resolve GObjects
-    __int64 gobjects = ScanAndResolve(gameModule, gobjects_entry);
-    Globals::qword_18004FDD8 = gobjects;
+    // The startup scans are independent: run them as concurrent tasks on
+    // the startup pool. Each publishes its Globals slot when it completes.
+    for (int i = 0; i < static_cast<int>(PatternId::Count); ++i)
+    {
+        if (i == static_cast<int>(PatternId::InputKey))
+            continue;
 
-    // Resolve ProcessEvent
-    __int64 processEvent = ScanAndResolve(gameModule, pe_entry);
-    Globals::qword_18004FDE8 = reinterpret_cast<decltype(Globals::qword_18004FDE8)>(processEvent);
+        PatternScan::LazyPattern* handle = &g_Patterns[i];
+        g_PatternTasks[i] = ThreadPool::Submit([handle]() { return handle->Get(); });
+    }
 
-    // Resolve FNameToString
-    __int64 fnameToString = ScanAndResolve(gameModule, fnts_entry);
-    Globals::qword_18004FDC8 = fnameToString;
+    // GWorld is the only result StartAddress needs before MainGameSetup.
+    // If it failed there is no point deferring the other reports.
+    g_PatternTasks[static_cast<int>(PatternId::GWorld)].wait();
+    if (!GetPattern(PatternId::GWorld).Get())
+        ResolveDeferredPatterns();
+
+    return static_cast<int>(Globals::qword_18004FDB0);
+}
 
-    // Resolve GWorld
-    __int64 gworld = ScanAndResolve(gameModule, gw_entry);
-    Globals::qword_18004FDB0 = gworld;
+// ============================================================================
+// ResolveDeferredPatterns
+//
+// Waits for the pattern tasks submitted by InitializePatterns (everything
+// MainGameSetup dereferences), then runs the validation that sub_180027620
+// did inline after resolving everything. InputKey is then scanned in the
+// background, and validated by its own resolver, so its pattern-mismatch
+// report still comes at startup without MainGameSetup waiting for it.
+// ============================================================================
+void VersionManager::ResolveDeferredPatterns()
+{
+    static bool validated = false;
+    if (validated)
+        return;
+    validated = true;
 
-    // Resolve InputKey
-    __int64 inputkey = ScanAndResolve(gameModule, ik_entry);
-    Globals::qword_18004FDA8 = inputkey;
+    for (auto& task : g_PatternTasks)
+    {
+        if (task.valid())
+            task.wait();
+    }
 
     // Validate all critical addresses
-    __int64 v89 = Globals::qword_18004FDD8;
     if (!Globals::qword_18004FDD8)
-    {
         MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
-        v89 = Globals::qword_18004FDD8;
-    }
     if (!Globals::qword_18004FDE8)
-    {
         MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
-        v89 = Globals::qword_18004FDD8;
-    }
     if (!Globals::qword_18004FDC8)
-    {
         MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
-        v89 = Globals::qword_18004FDD8;
-    }
     if (!Globals::qword_18004FDB0)
-    {
-        MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
-        v89 = Globals::qword_18004FDD8;
-    }
-    if (!Globals::qword_18004FDA8)
-    {
         MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
-        v89 = Globals::qword_18004FDD8;
-    }
-
-    // ========================================================================
-    // Version-specific GObjects adjustment and PatternLink creation
-    // This section adjusts the GObjects address based on version range,
-    // scanning forward from the resolved address to find a wildcard boundary.
-    // ========================================================================
-    int engineVer = Globals::dword_18004FDE0;
-
-    if (static_cast<unsigned int>(engineVer - 4204761) <= 0x2679)
-    {
-        // Version range: 4204761 - 4214617 (exactly matches (unsigned)(v-4204761) <= 0x2679)
-        // Scan forward from GObjects+2, looking for 4 consecutive -1 (wildcard) int32s
-        char* scan = reinterpret_cast<char*>(v89 + 2);
-        char* found = nullptr;
-        __int64 limit = -2 - v89;
-        do
-        {
-            found = scan - 2;
-            if (*reinterpret_cast<int*>(scan - 2) == -1) break;
-            found = scan - 1;
-            if (*reinterpret_cast<int*>(scan - 1) == -1) break;
-            found = scan;
-            if (*reinterpret_cast<int*>(scan) == -1) break;
-            found = scan + 1;
-            if (*reinterpret_cast<int*>(scan + 1) == -1) break;
-            scan += 4;
-        } while (reinterpret_cast<__int64>(&scan[limit]) < 2048);
-
-        Globals::qword_18004FDD8 = reinterpret_cast<__int64>(found - 24);
-
-        // Create PatternLink structure (0x10 bytes)
-        auto* plink = reinterpret_cast<__int64*>(operator new(0x10));
-        *reinterpret_cast<unsigned __int128*>(plink) = 0;
-        *reinterpret_cast<unsigned char*>(plink) = 1;
-        plink[1] = Globals::qword_18004FDD8;
-        Globals::qword_18004FDF0 = reinterpret_cast<__int64>(plink);
-    }
-    else if (static_cast<unsigned int>(engineVer - 4225813) <= 0x397C8)
-    {
-        // Version range: 4225813 - 4461513
-        char* scan = reinterpret_cast<char*>(v89 + 2);
-        char* found = nullptr;
-        __int64 limit = -2 - v89;
-        do
-        {
-            found = scan - 2;
-            if (*reinterpret_cast<int*>(scan - 2) == -1) break;
-            found = scan - 1;
-            if (*reinterpret_cast<int*>(scan - 1) == -1) break;
-            found = scan;
-            if (*reinterpret_cast<int*>(scan) == -1) break;
-            found = scan + 1;
-            if (*reinterpret_cast<int*>(scan + 1) == -1) break;
-            scan += 4;
-        } while (reinterpret_cast<__int64>(&scan[limit]) < 2048);
-
-        Globals::qword_18004FDD8 = reinterpret_cast<__int64>(found - 32);
-
-        auto* plink = reinterpret_cast<__int64*>(operator new(0x10));
-        *reinterpret_cast<unsigned __int128*>(plink) = 0;
-        *reinterpret_cast<unsigned char*>(plink) = 2;
-        plink[1] = Globals::qword_18004FDD8;
-        Globals::qword_18004FDF0 = reinterpret_cast<__int64>(plink);
-    }
-    else if (engineVer < 4464155)
-    {
-        // Versions between 4461514 and 4464154
-        char* scan = reinterpret_cast<char*>(v89 + 2);
-        char* found = nullptr;
-        __int64 limit = -2 - v89;
-        do
-        {
-            found = scan - 2;
-            if (*reinterpret_cast<int*>(scan - 2) == -1) break;
-            found = scan - 1;
-            if (*reinterpret_cast<int*>(scan - 1) == -1) break;
-            found = scan;
-            if (*reinterpret_cast<int*>(scan) == -1) break;
-            found = scan + 1;
-            if (*reinterpret_cast<int*>(scan + 1) == -1) break;
-            scan += 4;
-        } while (reinterpret_cast<__int64>(&scan[limit]) < 2048);
-
-        Globals::qword_18004FDD8 = reinterpret_cast<__int64>(found - 16);
-
-        auto* plink = reinterpret_cast<__int64*>(operator new(0x10));
-        *reinterpret_cast<unsigned __int128*>(plink) = 0;
-        *reinterpret_cast<unsigned char*>(plink) = 2;
-        plink[1] = Globals::qword_18004FDD8;
-        Globals::qword_18004FDF0 = reinterpret_cast<__int64>(plink);
-    }
-    // else: versions >= 4464155 don't need GObjects adjustment
 
     if (!Globals::qword_18004FDF0)
         MessageBoxA(nullptr, "An error has occured.", "Error", MB_ICONERROR);
 
-    return static_cast<int>(Globals::qword_18004FDD8);
+    // Resolvers scan their own copies of the signatures, so nothing refers
+    // to the built-in configs any more. They are dropped with the arena,
+    // without running destructors.
+    g_VersionConfigs = nullptr;
+    StartupArena::Release();
+
+    // Publishes qword_18004FDA8; a later Get() joins this scan
+    PatternScan::LazyPattern* inputKey = &GetPattern(PatternId::InputKey);
+    PatternScan::LazyPattern::Prefetch(&inputKey, 1);
 }
@@ -0,0 +1,151 @@
+/*
+ * Rift - Pattern Decryption Tests
+ *
+ * Differential check of the DecryptPattern tiers (hooks.cpp) against the
+ * scalar reference, a check of every embedded blob, and the throughput of
+ * each tier.
+ */
+
+#include "tests.h"
+#include "hooks.h"
+#include "encrypted_blobs.h"
+#include <cstring>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace Tests {
+
+struct DecryptTier {
+    const char* name;
+    void (*fn)(char*, int);
+};
+
+static const DecryptTier g_DecryptTiers[] = {
+    {"scalar", Hooks::DecryptPatternScalar},
+    {"sse4.1", Hooks::DecryptPatternSSE41},
+};
+
+// Expected plaintext of each blob, as its length and FNV-1a hash so the
+// patterns themselves stay encrypted in the tree
+struct KnownBlob {
+    EncryptedBlobs::BlobId id;
+    size_t length;
+    uint64_t hash;
+};
+
+static const KnownBlob g_KnownBlobs[] = {
+    {EncryptedBlobs::BlobId::HookPatchTarget,    63, 0x6a4f9b074040640bull},
+    {EncryptedBlobs::BlobId::HookPatchSecondary, 44, 0xeb883896862f92a5ull},
+    {EncryptedBlobs::BlobId::AdditionalHookFunc, 94, 0xf2db10f7a61c0362ull},
+    {EncryptedBlobs::BlobId::AdditionalAddr,     83, 0x9e98554b38407bc1ull},
+    {EncryptedBlobs::BlobId::InputKey1,          86, 0x69d8fa38f6e1a368ull},
+    {EncryptedBlobs::BlobId::InputKey2,          74, 0x8a618e6fbbbf6d2dull},
+    {EncryptedBlobs::BlobId::InputKey3,          81, 0xdc607fbd0d426d41ull},
+    {EncryptedBlobs::BlobId::InputKey4,          77, 0x7de2c54f400e9689ull},
+};
+
+static uint64_t Fnv1a(std::string_view text)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : text)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static constexpr int kMaxLength = 4096;
+
+// Every tier against the scalar reference for every length in
+// [0, kMaxLength] at every start offset in [0, 15]. The pattern sits
+// inside a guarded buffer, so stray writes before or after it (the SIMD
+// tier addresses the buffer through ptr - 12 / ptr - 8) are caught.
+bool DecryptTiers()
+{
+    constexpr int kGuard = 32;
+
+    std::mt19937 rng(0x52494654u);
+    std::vector<char> input(kMaxLength + 2 * kGuard);
+    std::vector<char> expected(input.size());
+    std::vector<char> actual(input.size());
+
+    for (int offset = 0; offset < 16; ++offset)
+    {
+        for (auto& c : input)
+            c = static_cast<char>(rng());
+
+        for (int length = 0; length <= kMaxLength; ++length)
+        {
+            expected = input;
+            Hooks::DecryptPatternScalar(expected.data() + kGuard + offset, length);
+
+            for (const auto& tier : g_DecryptTiers)
+            {
+                actual = input;
+                tier.fn(actual.data() + kGuard + offset, length);
+                if (actual != expected)
+                {
+                    return Fail("tier '%s' diverged from scalar (length %d, offset %d)",
+                                tier.name, length, offset);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Every registered blob decrypts to its known plaintext through each tier
+// and through the startup arena
+bool DecryptBlobs()
+{
+    if (!EncryptedBlobs::DecryptAll())
+        return Fail("the blob arena could not be set up");
+
+    bool ok = true;
+    for (const auto& blob : g_KnownBlobs)
+    {
+        const auto& info = EncryptedBlobs::GetInfo(blob.id);
+
+        for (const auto& tier : g_DecryptTiers)
+        {
+            std::vector<char> buf(info.data, info.data + info.length);
+            tier.fn(buf.data(), info.length);
+            std::string_view text(buf.data(), strnlen(buf.data(), buf.size()));
+            if (text.size() != blob.length || Fnv1a(text) != blob.hash)
+            {
+                ok = Fail("blob '%s' does not decrypt to its plaintext with tier '%s'",
+                          info.purpose, tier.name);
+            }
+        }
+
+        std::string_view arena = EncryptedBlobs::Get(blob.id);
+        if (arena.size() != blob.length || Fnv1a(arena) != blob.hash)
+            ok = Fail("blob '%s' is wrong in the decrypted arena", info.purpose);
+    }
+    return ok;
+}
+
+// Decrypt the same 4 KiB buffer repeatedly per tier
+void BenchDecrypt()
+{
+    constexpr int kRounds = 20000;
+    std::vector<char> buffer(kMaxLength, 0x5A);
+
+    for (const auto& tier : g_DecryptTiers)
+    {
+        LARGE_INTEGER start;
+        QueryPerformanceCounter(&start);
+        for (int r = 0; r < kRounds; ++r)
+            tier.fn(buffer.data(), kMaxLength);
+        double seconds = Elapsed(start);
+
+        double mbps = seconds > 0.0
+            ? (static_cast<double>(kMaxLength) * kRounds) / (seconds * 1024.0 * 1024.0)
+            : 0.0;
+        Report("DecryptPattern %-7s %10.1f MiB/s", tier.name, mbps);
+    }
+}
+
+} // namespace Tests
@@ -0,0 +1,614 @@
+/*
+ * Rift - Synthetic GObjects Tests
+ *
+ * Lays out a fake object graph the way the engine does so StaticFindObject
+ * (sub_1800072D0), FindPropertyOffset (sub_180007790) and the GObjects
+ * index can be checked and timed without a game attached.
+ *
+ * Type 1 (flat) and type 2 (chunked) GObjects arrays are built in ordinary
+ * memory with the layout ue4_sdk.cpp reads: 24-byte FUObjectItem slots,
+ * 0xFFFF-slot chunks, FName at +0x18, Outer at +0x20, UProperty offset at
+ * +0x44 and a property chain at +0x50 (Next +0x20, FName +0x28, offset
+ * +0x4C), named through a stand-in FNameToString.
+ */
+
+#include "tests.h"
+#include "ue4_sdk.h"
+#include "object_index.h"
+#include "safe_memory.h"
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Tests {
+
+// Objects in the synthetic arrays
+static constexpr int kObjectCount = 500000;
+
+// Layout read by ue4_sdk.cpp
+static constexpr int ITEM_STRIDE = 24;            // FUObjectItem
+static constexpr int ITEM_SERIAL_OFFSET = 16;     // FUObjectItem::SerialNumber
+static constexpr int CHUNK_SIZE = 0xFFFF;
+static constexpr int FNAME_OFFSET = 0x18;
+static constexpr int OUTER_OFFSET = 0x20;
+static constexpr int PROP_OFFSET_FIELD = 0x44;
+static constexpr int CLASS_PROPLINK_OFFSET = 0x50;
+static constexpr int NODE_CLASS_OFFSET = 0x08;    // FField::ClassPrivate
+static constexpr int NODE_NEXT_OFFSET = 0x20;
+static constexpr int NODE_NAME_OFFSET = 0x28;
+static constexpr int NODE_OFFSET_FIELD = 0x4C;
+static constexpr int OBJECT_SIZE = 0x60;
+
+// Every 16 slots: one class, 8 properties of it, 7 instances of it
+static constexpr int GROUP = 16;
+static constexpr int PROPS_PER_CLASS = 8;
+
+// Engine versions that select each layout's property lookup
+static constexpr int VERSION_FLAT = 4204761;        // Flat24, object sweep
+static constexpr int VERSION_CHUNKED = 4225813;     // Chunked32, object sweep
+static constexpr int VERSION_PROPERTY_LINK = 11794982;
+
+struct alignas(16) FakeObject {
+    unsigned char bytes[OBJECT_SIZE];
+};
+
+template <typename T>
+static void Put(void* base, int offset, T value)
+{
+    std::memcpy(static_cast<unsigned char*>(base) + offset, &value, sizeof(T));
+}
+
+// ============================================================================
+// Object graph
+// ============================================================================
+
+// FName ComparisonIndex -> name; read by the FNameToString stand-in, which
+// sweep threads call concurrently (the table is never written meanwhile)
+static std::vector<std::wstring> g_Names;
+
+// Fills the FString the way the engine does: Data, then Num and Max, both
+// counting the terminator, so FetchWideName takes the length from Num
+static void __fastcall FakeFNameToString(__int64* fname, __int64* out)
+{
+    auto index = static_cast<uint32_t>(*fname);
+    if (index >= g_Names.size())
+    {
+        out[0] = 0;
+        out[1] = 0;
+        return;
+    }
+
+    auto num = static_cast<uint32_t>(g_Names[index].size() + 1);
+    out[0] = reinterpret_cast<__int64>(g_Names[index].c_str());
+    out[1] = static_cast<__int64>((static_cast<uint64_t>(num) << 32) | num);
+}
+
+struct Graph {
+    std::vector<FakeObject> objects;
+    std::vector<FakeObject> nodes;     // property chain nodes
+    FakeObject fieldClass;             // ClassPrivate of every node
+
+    // type 1
+    std::vector<unsigned char> flatItems;
+    unsigned char flatBase[16];
+    // type 2
+    std::vector<std::vector<unsigned char>> chunks;
+    std::vector<__int64> chunkTable;
+    unsigned char chunkedBase[24];
+};
+
+static std::wstring Widen(const std::string& text)
+{
+    return std::wstring(text.begin(), text.end());
+}
+
+static int ClassName(int group) { return PROPS_PER_CLASS + group; }
+
+static void BuildGraph(Graph& graph, int count)
+{
+    int groups = (count + GROUP - 1) / GROUP;
+
+    g_Names.clear();
+    for (int p = 0; p < PROPS_PER_CLASS; ++p)
+        g_Names.push_back(Widen("Prop" + std::to_string(p)));
+    for (int g = 0; g < groups; ++g)
+        g_Names.push_back(Widen("Class" + std::to_string(g)));
+    int firstInstanceName = static_cast<int>(g_Names.size());
+    for (int i = 0; i < count; ++i)
+        g_Names.push_back(Widen("Object" + std::to_string(i)));
+
+    graph.objects.assign(count, FakeObject{});
+    graph.nodes.assign(static_cast<size_t>(groups) * PROPS_PER_CLASS, FakeObject{});
+    graph.fieldClass = FakeObject{};
+
+    for (int i = 0; i < count; ++i)
+    {
+        FakeObject& obj = graph.objects[i];
+        int group = i / GROUP;
+        int role = i % GROUP;
+        FakeObject& cls = graph.objects[group * GROUP];
+
+        if (role == 0)
+        {
+            Put<uint64_t>(&obj, FNAME_OFFSET, static_cast<uint64_t>(ClassName(group)));
+            FakeObject* node = &graph.nodes[static_cast<size_t>(group) * PROPS_PER_CLASS];
+            Put<__int64>(&obj, CLASS_PROPLINK_OFFSET, reinterpret_cast<__int64>(node));
+        }
+        else if (role <= PROPS_PER_CLASS)
+        {
+            Put<uint64_t>(&obj, FNAME_OFFSET, static_cast<uint64_t>(role - 1));
+            Put<__int64>(&obj, OUTER_OFFSET, reinterpret_cast<__int64>(&cls));
+            Put<int>(&obj, PROP_OFFSET_FIELD, role * 8);
+        }
+        else
+        {
+            Put<uint64_t>(&obj, FNAME_OFFSET, static_cast<uint64_t>(firstInstanceName + i));
+            Put<__int64>(&obj, OUTER_OFFSET, reinterpret_cast<__int64>(&cls));
+        }
+    }
+
+    for (int g = 0; g < groups; ++g)
+    {
+        for (int p = 0; p < PROPS_PER_CLASS; ++p)
+        {
+            size_t n = static_cast<size_t>(g) * PROPS_PER_CLASS + p;
+            FakeObject& node = graph.nodes[n];
+            Put<__int64>(&node, NODE_CLASS_OFFSET, reinterpret_cast<__int64>(&graph.fieldClass));
+            Put<__int64>(&node, NODE_NEXT_OFFSET, p + 1 < PROPS_PER_CLASS
+                ? reinterpret_cast<__int64>(&graph.nodes[n + 1]) : 0);
+            Put<uint64_t>(&node, NODE_NAME_OFFSET, static_cast<uint64_t>(p));
+            Put<int>(&node, NODE_OFFSET_FIELD, (p + 1) * 8);
+        }
+    }
+
+    // Type 1: one flat item array, count at +12
+    graph.flatItems.assign(static_cast<size_t>(count) * ITEM_STRIDE, 0);
+    for (int i = 0; i < count; ++i)
+    {
+        Put<__int64>(graph.flatItems.data(), i * ITEM_STRIDE,
+                     reinterpret_cast<__int64>(&graph.objects[i]));
+    }
+    std::memset(graph.flatBase, 0, sizeof(graph.flatBase));
+    Put<__int64>(graph.flatBase, 0, reinterpret_cast<__int64>(graph.flatItems.data()));
+    Put<int>(graph.flatBase, 12, count);
+
+    // Type 2: chunk 0 holds slots 0 .. 0xFFFF, chunk k the next 0xFFFF at
+    // within-chunk slots 1 .. 0xFFFF (see ChunkedArrayAccess). A leading
+    // null chunk pointer exercises the first-valid-chunk scan.
+    int chunkCount = 1;
+    if (count > CHUNK_SIZE + 1)
+        chunkCount += (count - (CHUNK_SIZE + 1) + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    graph.chunks.assign(chunkCount, std::vector<unsigned char>(
+        static_cast<size_t>(CHUNK_SIZE + 1) * ITEM_STRIDE, 0));
+    for (int i = 0; i < count; ++i)
+    {
+        int chunk = i / CHUNK_SIZE;
+        if (chunk && CHUNK_SIZE * chunk == i)
+            --chunk;
+        int within = i - CHUNK_SIZE * chunk;
+        Put<__int64>(graph.chunks[chunk].data(), within * ITEM_STRIDE,
+                     reinterpret_cast<__int64>(&graph.objects[i]));
+    }
+    graph.chunkTable.assign(1, 0);
+    for (auto& chunk : graph.chunks)
+        graph.chunkTable.push_back(reinterpret_cast<__int64>(chunk.data()));
+    graph.chunkTable.push_back(0);
+    std::memset(graph.chunkedBase, 0, sizeof(graph.chunkedBase));
+    Put<__int64>(graph.chunkedBase, 0, reinterpret_cast<__int64>(graph.chunkTable.data()));
+    Put<int>(graph.chunkedBase, 20, count);
+}
+
+// Built on first use and shared by every test and benchmark
+static Graph& SharedGraph()
+{
+    static Graph graph;
+    static bool built = false;
+    if (!built)
+    {
+        BuildGraph(graph, kObjectCount);
+        // Let the fault-safe reader see the new heap right away
+        SafeMemory::Refresh();
+        built = true;
+    }
+    return graph;
+}
+
+struct Layout {
+    const char* name;
+    unsigned char type;
+    int version;
+};
+
+static const Layout g_Layouts[] = {
+    {"flat",          1, VERSION_FLAT},
+    {"chunked",       2, VERSION_CHUNKED},
+    {"chunked/chain", 2, VERSION_PROPERTY_LINK},
+};
+
+// Points the engine globals at one layout of the graph for its lifetime,
+// with empty lookup caches, and puts the previous globals back afterwards
+class InstalledLayout {
+public:
+    InstalledLayout(const Graph& graph, const Layout& layout)
+        : m_patternLink(Globals::qword_18004FDF0),
+          m_fnameToString(Globals::qword_18004FDC8),
+          m_version(Globals::dword_18004FDE0)
+    {
+        m_link[0] = 0;
+        *reinterpret_cast<unsigned char*>(m_link) = layout.type;
+        m_link[1] = reinterpret_cast<__int64>(layout.type == 1 ? graph.flatBase
+                                                               : graph.chunkedBase);
+        Globals::qword_18004FDF0 = reinterpret_cast<__int64>(m_link);
+        Globals::qword_18004FDC8 = reinterpret_cast<__int64>(&FakeFNameToString);
+        Globals::dword_18004FDE0 = layout.version;
+        UE4::ResetCaches();
+    }
+
+    ~InstalledLayout()
+    {
+        Globals::qword_18004FDF0 = m_patternLink;
+        Globals::qword_18004FDC8 = m_fnameToString;
+        Globals::dword_18004FDE0 = m_version;
+        UE4::ResetCaches();
+    }
+
+    InstalledLayout(const InstalledLayout&) = delete;
+    InstalledLayout& operator=(const InstalledLayout&) = delete;
+
+private:
+    __int64 m_link[2];
+    __int64 m_patternLink;
+    __int64 m_fnameToString;
+    int m_version;
+};
+
+// ============================================================================
+// Lookups
+// ============================================================================
+
+static constexpr int kLookups = 1000;
+
+// Random classes and instances (unique names; property names repeat)
+struct ObjectSample {
+    std::vector<int> picks;
+    std::vector<std::string> names;
+};
+
+static ObjectSample SampleObjects(const Graph& graph, std::mt19937& rng)
+{
+    ObjectSample sample;
+    sample.picks.resize(kLookups);
+    sample.names.resize(kLookups);
+    for (int k = 0; k < kLookups; ++k)
+    {
+        int i;
+        do {
+            i = static_cast<int>(rng() % static_cast<unsigned>(kObjectCount));
+        } while (i % GROUP && i % GROUP <= PROPS_PER_CLASS);
+        sample.picks[k] = i;
+        sample.names[k] = UE4::GetObjectName(reinterpret_cast<__int64>(&graph.objects[i]));
+    }
+    return sample;
+}
+
+// Random (class, property) pairs and their offsets
+struct PropertySample {
+    std::vector<std::string> classes;
+    std::vector<std::string> props;
+    std::vector<int> expected;
+};
+
+static PropertySample SampleProperties(std::mt19937& rng)
+{
+    PropertySample sample;
+    int groups = kObjectCount / GROUP;
+    for (int k = 0; k < kLookups; ++k)
+    {
+        int group = static_cast<int>(rng() % static_cast<unsigned>(groups));
+        int prop = static_cast<int>(rng() % PROPS_PER_CLASS);
+        sample.classes.push_back("Class" + std::to_string(group));
+        sample.props.push_back("Prop" + std::to_string(prop));
+        sample.expected.push_back((prop + 1) * 8);
+    }
+    return sample;
+}
+
+static bool CheckLayout(const Layout& layout)
+{
+    const Graph& graph = SharedGraph();
+    InstalledLayout installed(graph, layout);
+
+    // A sweep that matches nothing visits every slot once
+    UE4::ObjectTable table = UE4::ObjectTable::Capture();
+    int hit = UE4::ParallelSweep(table, [](__int64 obj, int) {
+        return *reinterpret_cast<uint64_t*>(obj + FNAME_OFFSET) == ~0ull;
+    });
+    if (hit != -1 || UE4::GetObjectCount() != kObjectCount)
+        return Fail("%s: sweep visited the wrong slots", layout.name);
+
+    std::mt19937 rng(0x52494654u);
+    ObjectSample objects = SampleObjects(graph, rng);
+    for (int k = 0; k < kLookups; ++k)
+    {
+        if (UE4::StaticFindObject(objects.names[k].c_str()) !=
+            reinterpret_cast<__int64>(&graph.objects[objects.picks[k]]))
+        {
+            return Fail("%s: StaticFindObject returned the wrong object for %s",
+                        layout.name, objects.names[k].c_str());
+        }
+    }
+
+    // Twice: resolved, then from the offset cache
+    PropertySample props = SampleProperties(rng);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int k = 0; k < kLookups; ++k)
+        {
+            int offset = UE4::FindPropertyOffset(props.classes[k].c_str(), props.props[k].c_str());
+            if (offset != props.expected[k])
+            {
+                return Fail("%s: FindPropertyOffset gave %d for %s::%s (pass %d)",
+                            layout.name, offset, props.classes[k].c_str(),
+                            props.props[k].c_str(), pass);
+            }
+        }
+    }
+    return true;
+}
+
+bool GObjectsFlat()      { return CheckLayout(g_Layouts[0]); }
+bool GObjectsChunked()   { return CheckLayout(g_Layouts[1]); }
+bool GObjectsChain()     { return CheckLayout(g_Layouts[2]); }
+
+// FindBatch on the PropertyLink layout: objects and classes the index
+// answers, a class renamed in place (the index misses it, so the batch's
+// own sweep has to find it and walk its chain) and misses of every kind
+bool GObjectsBatch()
+{
+    Graph& graph = SharedGraph();
+    InstalledLayout installed(graph, g_Layouts[2]);
+    ObjectIndex::Build();
+
+    // Renamed without a new serial number: only a sweep sees it
+    constexpr int kRenamedGroup = 5000;
+    FakeObject& renamed = graph.objects[kRenamedGroup * GROUP];
+    uint64_t oldFName;
+    std::memcpy(&oldFName, renamed.bytes + FNAME_OFFSET, sizeof(oldFName));
+    g_Names.push_back(L"LateClass");
+    Put<uint64_t>(&renamed, FNAME_OFFSET, static_cast<uint64_t>(g_Names.size() - 1));
+
+    constexpr int kInstance = 7 * GROUP + PROPS_PER_CLASS + 3;
+    std::string instanceName =
+        UE4::GetObjectName(reinterpret_cast<__int64>(&graph.objects[kInstance]));
+
+    UE4::ObjectQuery objects[] = {
+        {"Class5", 0},
+        {instanceName.c_str(), 0},
+        {"NoSuchObject", 0},
+        {"LateClass", 0},
+    };
+    const __int64 expectedObjects[] = {
+        reinterpret_cast<__int64>(&graph.objects[5 * GROUP]),
+        reinterpret_cast<__int64>(&graph.objects[kInstance]),
+        0,
+        reinterpret_cast<__int64>(&renamed),
+    };
+
+    UE4::PropertyQuery properties[] = {
+        {"Class7", "Prop3", 0, false},
+        {"LateClass", "Prop5", 0, false},
+        {"Class7", "NoSuchProp", 0, false},
+        {"NoSuchClass", "Prop1", 0, false},
+    };
+    const int expectedOffsets[] = {4 * 8, 6 * 8, 0, 0};
+
+    size_t misses = UE4::FindBatch(objects, 4, properties, 4);
+
+    bool ok = true;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (objects[i].result != expectedObjects[i])
+            ok = Fail("batch: wrong object for %s", objects[i].name);
+        if (properties[i].offset != expectedOffsets[i] ||
+            properties[i].found != (expectedOffsets[i] != 0))
+        {
+            ok = Fail("batch: %s::%s gave %d", properties[i].className,
+                      properties[i].propertyName, properties[i].offset);
+        }
+    }
+    if (misses != 3)
+        ok = Fail("batch: reported %zu misses instead of 3", misses);
+
+    Put<uint64_t>(&renamed, FNAME_OFFSET, oldFName);
+    g_Names.pop_back();
+    return ok;
+}
+
+// A slot reused for a differently named object (new serial number) is
+// found after a Refresh() whose re-check window covers it, and its old
+// name no longer resolves to it
+bool GObjectsRecheck()
+{
+    Graph& graph = SharedGraph();
+    InstalledLayout installed(graph, g_Layouts[1]);
+    ObjectIndex::Build();
+
+    // An instance slot past the first chunk
+    constexpr int kSlot = 3 * CHUNK_SIZE + GROUP - 1;
+    FakeObject& obj = graph.objects[kSlot];
+    auto objAddress = reinterpret_cast<__int64>(&obj);
+    std::string oldName = UE4::GetObjectName(objAddress);
+
+    uint64_t oldFName;
+    std::memcpy(&oldFName, obj.bytes + FNAME_OFFSET, sizeof(oldFName));
+    unsigned char* item = graph.chunks[kSlot / CHUNK_SIZE].data() +
+                          (kSlot % CHUNK_SIZE) * ITEM_STRIDE;
+    int oldSerial;
+    std::memcpy(&oldSerial, item + ITEM_SERIAL_OFFSET, sizeof(oldSerial));
+
+    // g_Names is only resized here, with no sweep running
+    g_Names.push_back(L"Reused");
+    Put<uint64_t>(&obj, FNAME_OFFSET, static_cast<uint64_t>(g_Names.size() - 1));
+    Put<int>(item, ITEM_SERIAL_OFFSET, oldSerial + 1);
+
+    // Another instance whose slot is emptied; its object stays readable,
+    // so only the index can tell that it is gone
+    constexpr int kEmptied = 4 * CHUNK_SIZE + GROUP - 2;
+    std::string emptiedName = UE4::GetObjectName(reinterpret_cast<__int64>(&graph.objects[kEmptied]));
+    unsigned char* emptiedItem = graph.chunks[kEmptied / CHUNK_SIZE].data() +
+                                 (kEmptied % CHUNK_SIZE) * ITEM_STRIDE;
+    __int64 emptiedObject;
+    std::memcpy(&emptiedObject, emptiedItem, sizeof(emptiedObject));
+    Put<__int64>(emptiedItem, 0, 0);
+
+    bool ok = true;
+    if (ObjectIndex::Find(oldName) != 0)
+        ok = Fail("recheck: the reused slot still answers to %s", oldName.c_str());
+
+    // Round robin from slot 0; kObjectCount covers every slot
+    ObjectIndex::Stats before = ObjectIndex::GetStats();
+    ObjectIndex::Refresh(kObjectCount);
+    ObjectIndex::Stats after = ObjectIndex::GetStats();
+    if (ok && ObjectIndex::Find("Reused") != objAddress)
+        ok = Fail("recheck: Refresh() did not index the reused slot");
+    if (ok && ObjectIndex::Find(emptiedName) != 0)
+        ok = Fail("recheck: the emptied slot still answers to %s", emptiedName.c_str());
+    // One name replaced, one dropped
+    if (ok && after.names != before.names - 1)
+        ok = Fail("recheck: %llu names after Refresh(), expected %llu",
+                  static_cast<unsigned long long>(after.names),
+                  static_cast<unsigned long long>(before.names - 1));
+
+    Put<__int64>(emptiedItem, 0, emptiedObject);
+    Put<uint64_t>(&obj, FNAME_OFFSET, oldFName);
+    Put<int>(item, ITEM_SERIAL_OFFSET, oldSerial);
+    g_Names.pop_back();
+    return ok;
+}
+
+// ParallelSweep hands out blocks of 8192 slots to several threads; a match
+// in every block must still report the lowest index
+static bool CheckSweep(const Layout& layout)
+{
+    UE4::ObjectTable table = UE4::ObjectTable::Capture();
+
+    constexpr int kPeriod = 8191;
+    int first = UE4::ParallelSweep(table, [](__int64, int index) {
+        return index % kPeriod == 5;
+    });
+    if (first != 5)
+        return Fail("%s: sweep matching every %dth slot returned %d, expected 5",
+                    layout.name, kPeriod, first);
+
+    // First match well past the first blocks
+    constexpr int kFrom = 100000;
+    constexpr int kExpected = (kFrom + kPeriod - 1 - 5) / kPeriod * kPeriod + 5;
+    first = UE4::ParallelSweep(table, [](__int64, int index) {
+        return index >= kFrom && index % kPeriod == 5;
+    });
+    if (first != kExpected)
+        return Fail("%s: sweep from slot %d returned %d, expected %d",
+                    layout.name, kFrom, first, kExpected);
+    return true;
+}
+
+// Objects renamed in place after the build: the index keeps the old names
+// and Refresh() only looks at new slots, so StaticFindObject has to fall
+// back to its own sweep (FindObjectType1/2). Several slots in different
+// blocks carry the name; the lowest one wins.
+static bool CheckSweepFallback(Graph& graph, const Layout& layout)
+{
+    const int renamedSlots[] = {kObjectCount - 3, 6 * 8192 + 1, 2 * 8192 + 17, 40 * 8192 + 3};
+    constexpr int kLowest = 2 * 8192 + 17;
+
+    uint64_t oldFNames[4];
+    g_Names.push_back(L"Swept");
+    for (int i = 0; i < 4; ++i)
+    {
+        FakeObject& obj = graph.objects[renamedSlots[i]];
+        std::memcpy(&oldFNames[i], obj.bytes + FNAME_OFFSET, sizeof(oldFNames[i]));
+        Put<uint64_t>(&obj, FNAME_OFFSET, static_cast<uint64_t>(g_Names.size() - 1));
+    }
+
+    bool ok = true;
+    __int64 found = UE4::StaticFindObject("Swept");
+    if (found != reinterpret_cast<__int64>(&graph.objects[kLowest]))
+        ok = Fail("%s: the fallback sweep did not return slot %d", layout.name, kLowest);
+
+    for (int i = 0; i < 4; ++i)
+        Put<uint64_t>(&graph.objects[renamedSlots[i]], FNAME_OFFSET, oldFNames[i]);
+    g_Names.pop_back();
+    return ok;
+}
+
+// Both object-sweep layouts: ParallelSweep directly, then through the
+// StaticFindObject fallback
+bool GObjectsSweep()
+{
+    Graph& graph = SharedGraph();
+
+    bool ok = true;
+    for (int i = 0; i < 2; ++i)
+    {
+        InstalledLayout installed(graph, g_Layouts[i]);
+        ok = CheckSweep(g_Layouts[i]) && ok;
+
+        ObjectIndex::Build();
+        ok = CheckSweepFallback(graph, g_Layouts[i]) && ok;
+    }
+    return ok;
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+static void Time(const Layout& layout, const char* what, const LARGE_INTEGER& start, int calls)
+{
+    Report("GObjects %-14s %-28s %12.3f us/call (%d calls)",
+           layout.name, what, Elapsed(start) * 1e6 / calls, calls);
+}
+
+// Per layout: a sweep that misses, the index build, then StaticFindObject
+// and FindPropertyOffset (resolved and cached) over random samples
+void BenchGObjects()
+{
+    const Graph& graph = SharedGraph();
+
+    for (const Layout& layout : g_Layouts)
+    {
+        InstalledLayout installed(graph, layout);
+        LARGE_INTEGER start;
+
+        UE4::ObjectTable table = UE4::ObjectTable::Capture();
+        QueryPerformanceCounter(&start);
+        UE4::ParallelSweep(table, [](__int64 obj, int) {
+            return *reinterpret_cast<uint64_t*>(obj + FNAME_OFFSET) == ~0ull;
+        });
+        Time(layout, "sweep (miss)", start, 1);
+
+        QueryPerformanceCounter(&start);
+        ObjectIndex::Build();
+        Time(layout, "index build", start, 1);
+
+        std::mt19937 rng(0x52494654u);
+        ObjectSample objects = SampleObjects(graph, rng);
+        QueryPerformanceCounter(&start);
+        for (int k = 0; k < kLookups; ++k)
+            UE4::StaticFindObject(objects.names[k].c_str());
+        Time(layout, "StaticFindObject", start, kLookups);
+
+        PropertySample props = SampleProperties(rng);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            QueryPerformanceCounter(&start);
+            for (int k = 0; k < kLookups; ++k)
+                UE4::FindPropertyOffset(props.classes[k].c_str(), props.props[k].c_str());
+            Time(layout, pass ? "FindPropertyOffset (cached)" : "FindPropertyOffset",
+                 start, kLookups);
+        }
+    }
+}
+
+} // namespace Tests
@@ -0,0 +1,152 @@
+/*
+ * Rift - Fault-Safe Memory Tests
+ *
+ * SafeMemory (safe_memory.cpp) against pages this test allocates and
+ * protects itself: committed memory, memory released after the snapshot
+ * was taken (only the SEH copy can tell), PAGE_NOACCESS and guard pages,
+ * and ranges that cross from one region into the next.
+ */
+
+#include "tests.h"
+#include "safe_memory.h"
+#include <cstring>
+
+namespace Tests {
+
+static constexpr size_t kPage = 4096;
+
+// Pages from VirtualAlloc, released on scope exit unless already released
+class Pages {
+public:
+    explicit Pages(size_t count)
+        : m_base(static_cast<unsigned char*>(VirtualAlloc(nullptr, count * kPage,
+                                                          MEM_COMMIT | MEM_RESERVE,
+                                                          PAGE_READWRITE)))
+    {
+        if (m_base)
+        {
+            for (size_t i = 0; i < count * kPage; ++i)
+                m_base[i] = static_cast<unsigned char>(i * 31 + 7);
+        }
+    }
+
+    ~Pages() { Release(); }
+
+    Pages(const Pages&) = delete;
+    Pages& operator=(const Pages&) = delete;
+
+    unsigned char* Page(size_t index) const { return m_base + index * kPage; }
+    explicit operator bool() const { return m_base != nullptr; }
+
+    bool Protect(size_t index, DWORD protect)
+    {
+        DWORD old;
+        return VirtualProtect(Page(index), kPage, protect, &old) != 0;
+    }
+
+    void Release()
+    {
+        if (m_base)
+            VirtualFree(m_base, 0, MEM_RELEASE);
+        m_base = nullptr;
+    }
+
+private:
+    unsigned char* m_base;
+};
+
+static bool CheckCommitted()
+{
+    Pages pages(2);
+    if (!pages)
+        return Fail("safe memory: VirtualAlloc failed");
+    SafeMemory::Refresh();
+
+    unsigned char copy[2 * kPage];
+    if (!SafeMemory::IsReadable(pages.Page(0), sizeof(copy)))
+        return Fail("safe memory: a committed page reads as unreadable");
+    if (!SafeMemory::Read(pages.Page(0), copy, sizeof(copy)) ||
+        std::memcmp(copy, pages.Page(0), sizeof(copy)) != 0)
+        return Fail("safe memory: Read() of a committed page did not copy it");
+    return true;
+}
+
+// Released after the snapshot: IsReadable still trusts the snapshot, the
+// copy faults and Read() fails; a refresh then drops the region
+static bool CheckReleased()
+{
+    Pages pages(1);
+    if (!pages)
+        return Fail("safe memory: VirtualAlloc failed");
+    unsigned char* page = pages.Page(0);
+    SafeMemory::Refresh();
+    pages.Release();
+
+    unsigned char copy[64];
+    if (SafeMemory::Read(page, copy, sizeof(copy)))
+        return Fail("safe memory: Read() of a released page succeeded");
+
+    SafeMemory::Refresh();
+    if (SafeMemory::IsReadable(page, sizeof(copy)))
+        return Fail("safe memory: a released page is readable after Refresh()");
+    return true;
+}
+
+static bool CheckProtected()
+{
+    Pages pages(3);
+    if (!pages)
+        return Fail("safe memory: VirtualAlloc failed");
+    if (!pages.Protect(1, PAGE_NOACCESS) || !pages.Protect(2, PAGE_READWRITE | PAGE_GUARD))
+        return Fail("safe memory: VirtualProtect failed");
+    SafeMemory::Refresh();
+
+    unsigned char copy[64];
+    bool ok = true;
+    if (!SafeMemory::Read(pages.Page(0), copy, sizeof(copy)))
+        ok = Fail("safe memory: the page before a PAGE_NOACCESS page is unreadable");
+    if (SafeMemory::IsReadable(pages.Page(1), 8) || SafeMemory::Read(pages.Page(1), copy, sizeof(copy)))
+        ok = Fail("safe memory: a PAGE_NOACCESS page reads as readable");
+    if (SafeMemory::IsReadable(pages.Page(2), 8) || SafeMemory::Read(pages.Page(2), copy, sizeof(copy)))
+        ok = Fail("safe memory: a guard page reads as readable");
+
+    pages.Protect(1, PAGE_READWRITE);
+    pages.Protect(2, PAGE_READWRITE);
+    return ok;
+}
+
+// Two readable regions with different protection are one range to the
+// snapshot; a range running into a PAGE_NOACCESS page is not readable
+static bool CheckStraddling()
+{
+    Pages pages(3);
+    if (!pages)
+        return Fail("safe memory: VirtualAlloc failed");
+    if (!pages.Protect(1, PAGE_READONLY) || !pages.Protect(2, PAGE_NOACCESS))
+        return Fail("safe memory: VirtualProtect failed");
+    SafeMemory::Refresh();
+
+    unsigned char copy[16];
+    bool ok = true;
+    if (!SafeMemory::Read(pages.Page(1) - 8, copy, sizeof(copy)) ||
+        std::memcmp(copy, pages.Page(1) - 8, sizeof(copy)) != 0)
+        ok = Fail("safe memory: a range across two readable regions is unreadable");
+    if (SafeMemory::IsReadable(pages.Page(2) - 8, sizeof(copy)) ||
+        SafeMemory::Read(pages.Page(2) - 8, copy, sizeof(copy)))
+        ok = Fail("safe memory: a range running into a PAGE_NOACCESS page is readable");
+
+    pages.Protect(1, PAGE_READWRITE);
+    pages.Protect(2, PAGE_READWRITE);
+    return ok;
+}
+
+bool SafeMemoryRegions()
+{
+    bool ok = CheckCommitted();
+    ok = CheckReleased() && ok;
+    ok = CheckProtected() && ok;
+    ok = CheckStraddling() && ok;
+    return ok;
+}
+
+} // namespace Tests
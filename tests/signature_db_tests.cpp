@@ -0,0 +1,250 @@
+/*
+ * Rift - Signature Database Tests
+ *
+ * data/signatures.json restates the built-in version table, pattern sets
+ * and patches (version_config.cpp, hooks.cpp). Compile it with the sigdbc
+ * code, map the image and check it against the built-in tables record by
+ * record, so the two cannot drift apart unnoticed.
+ */
+
+#include "tests.h"
+#include "signature_db.h"
+#include "version_config.h"
+#include "encrypted_blobs.h"
+#include "hooks.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Tests {
+
+// Run from the repository root or from tests\ (the Visual Studio default)
+static const char* const kSourcePaths[] = {
+    "data/signatures.json",
+    "../data/signatures.json",
+};
+
+static const char kImagePath[] = "rift_tests_signatures.rsdb";
+
+// Every symbol a pattern set may name; the last two come from "common"
+static const char* const kSetPatterns[] = {
+    "GObjects", "ProcessEvent", "FNameToString", "GWorld", "InputKey",
+    "AdditionalHookFunc", "AdditionalAddr",
+};
+
+static constexpr int kVersionPatterns = 5;
+
+struct AdditionalPattern {
+    const char* name;
+    EncryptedBlobs::BlobId blob;
+};
+
+static const AdditionalPattern g_AdditionalPatterns[] = {
+    {"AdditionalHookFunc", EncryptedBlobs::BlobId::AdditionalHookFunc},
+    {"AdditionalAddr",     EncryptedBlobs::BlobId::AdditionalAddr},
+};
+
+static bool SamePattern(const PatternScan::PatternView& a, const PatternScan::PatternView& b)
+{
+    return a.size == b.size &&
+           std::memcmp(a.bytes, b.bytes, static_cast<size_t>(a.size)) == 0 &&
+           std::memcmp(a.mask, b.mask, static_cast<size_t>(a.size)) == 0;
+}
+
+static bool SameRef(const SignatureDB::PatternRef& a, const SignatureDB::PatternRef& b)
+{
+    if (a.count != b.count)
+        return false;
+    for (int i = 0; i < a.count; ++i)
+    {
+        if (a.signatures[i].offset_a != b.signatures[i].offset_a ||
+            a.signatures[i].offset_b != b.signatures[i].offset_b ||
+            !SamePattern(a.signatures[i].pattern, b.signatures[i].pattern))
+            return false;
+    }
+    return true;
+}
+
+static bool SameFeatures(const VersionFeatures& a, const VersionFeatures& b)
+{
+    return a.patternSet == b.patternSet && a.gobjectsLayout == b.gobjectsLayout &&
+           a.propertyChain == b.propertyChain && a.patches == b.patches;
+}
+
+// Intervals and the pattern names of each set, read straight from the
+// image file so nothing the loader skips goes unchecked
+static bool CheckImageLayout(const std::vector<unsigned char>& image,
+                             const VersionInterval* builtin, size_t builtinCount,
+                             int& setCount)
+{
+    if (image.size() < sizeof(SignatureDB::Header))
+        return Fail("the compiled image is too small");
+
+    SignatureDB::Header header;
+    std::memcpy(&header, image.data(), sizeof(header));
+
+    if (header.intervalCount != builtinCount)
+    {
+        return Fail("the image has %u version intervals, the built-in table %zu",
+                    header.intervalCount, builtinCount);
+    }
+    for (size_t i = 0; i < builtinCount; ++i)
+    {
+        VersionInterval interval;
+        std::memcpy(&interval, image.data() + header.intervalOffset + i * sizeof(interval),
+                    sizeof(interval));
+        if (interval.version_min != builtin[i].version_min ||
+            interval.version_max != builtin[i].version_max ||
+            !SameFeatures(interval.features, builtin[i].features))
+        {
+            return Fail("version interval %zu (%d - %d) differs from the built-in table",
+                        i, builtin[i].version_min, builtin[i].version_max);
+        }
+    }
+
+    const char* strings = reinterpret_cast<const char*>(image.data() + header.stringsOffset);
+    for (uint32_t s = 0; s < header.setCount; ++s)
+    {
+        SignatureDB::PatternSetRecord set;
+        std::memcpy(&set, image.data() + header.setOffset + s * sizeof(set), sizeof(set));
+        for (uint32_t i = 0; i < set.patternCount; ++i)
+        {
+            SignatureDB::PatternRecord record;
+            std::memcpy(&record, image.data() + header.patternOffset +
+                        (set.firstPattern + i) * sizeof(record), sizeof(record));
+
+            std::string_view name(strings + record.nameOffset);
+            bool known = false;
+            for (const char* expected : kSetPatterns)
+                known = known || name == expected;
+            if (!known)
+            {
+                return Fail("pattern set %u names '%.*s', which the DLL never resolves",
+                            s, static_cast<int>(name.size()), name.data());
+            }
+        }
+    }
+
+    setCount = static_cast<int>(header.setCount);
+    return true;
+}
+
+// Every pattern of every set, the common patterns and the patches, through
+// the mapped database against the built-in tables
+static bool CheckRecords(int setCount)
+{
+    bool ok = true;
+    for (int set = 0; set < setCount; ++set)
+    {
+        for (int i = 0; i < kVersionPatterns; ++i)
+        {
+            SignatureDB::PatternRef expected{}, actual{};
+            if (!VersionManager::FindBuiltinPattern(set, kSetPatterns[i], expected))
+            {
+                ok = Fail("the image has pattern set %d, the built-in configs do not", set);
+                break;
+            }
+            if (!SignatureDB::FindPattern(set, kSetPatterns[i], actual))
+                ok = Fail("pattern set %d has no %s", set, kSetPatterns[i]);
+            else if (!SameRef(expected, actual))
+                ok = Fail("%s in pattern set %d differs from the built-in config",
+                          kSetPatterns[i], set);
+        }
+
+        for (const auto& additional : g_AdditionalPatterns)
+        {
+            PatternScan::CompiledPattern compiled;
+            PatternScan::CompilePattern(EncryptedBlobs::Get(additional.blob), compiled);
+            SignatureDB::PatternRef expected{}, actual{};
+            expected.signatures[0] = SignatureDB::Signature{PatternScan::ViewOf(compiled), 0, 0};
+            expected.count = 1;
+
+            if (!SignatureDB::FindPattern(set, additional.name, actual))
+                ok = Fail("pattern set %d has no %s", set, additional.name);
+            else if (!SameRef(expected, actual))
+                ok = Fail("%s in pattern set %d differs from its blob", additional.name, set);
+        }
+    }
+
+    SignatureDB::PatternRef unused;
+    if (VersionManager::FindBuiltinPattern(setCount, kSetPatterns[0], unused))
+        ok = Fail("the built-in configs have more pattern sets than the image (%d)", setCount);
+
+    int builtinPatches = 0;
+    SignatureDB::PatchRecord expected, actual;
+    SignatureDB::PatternRef expectedPattern{}, actualPattern{};
+    for (; Hooks::GetBuiltinPatch(builtinPatches, expected, expectedPattern); ++builtinPatches)
+    {
+        uint32_t index = static_cast<uint32_t>(builtinPatches);
+        if (!SignatureDB::GetPatch(index, actual, actualPattern))
+        {
+            ok = Fail("patch %.*s is missing from the image",
+                      static_cast<int>(expectedPattern.name.size()), expectedPattern.name.data());
+            continue;
+        }
+        if (actual.offset != expected.offset || actual.value != expected.value ||
+            actual.patchSet != expected.patchSet || actual.protect != expected.protect ||
+            !SamePattern(actualPattern.signatures[0].pattern, expectedPattern.signatures[0].pattern))
+        {
+            ok = Fail("patch %.*s differs from the built-in one",
+                      static_cast<int>(expectedPattern.name.size()), expectedPattern.name.data());
+        }
+    }
+    if (SignatureDB::PatchCount() != static_cast<uint32_t>(builtinPatches))
+    {
+        ok = Fail("the image has %u patches, the built-in list %d",
+                  SignatureDB::PatchCount(), builtinPatches);
+    }
+    return ok;
+}
+
+bool SignatureSource()
+{
+    const char* source = nullptr;
+    std::error_code error;
+    for (const char* path : kSourcePaths)
+    {
+        if (std::filesystem::exists(path, error))
+        {
+            source = path;
+            break;
+        }
+    }
+    if (!source)
+        return Fail("data/signatures.json not found; run from the repository root or tests\\");
+
+    if (!EncryptedBlobs::DecryptAll())
+        return Fail("the blob arena could not be set up");
+    VersionManager::InitVersionConfigs();
+
+    std::string compileError;
+    if (!SignatureDB::CompileSource(source, kImagePath, compileError))
+        return Fail("sigdbc rejected %s: %s", source, compileError.c_str());
+
+    std::ifstream file(kImagePath, std::ios::binary);
+    std::vector<unsigned char> image((std::istreambuf_iterator<char>(file)),
+                                     std::istreambuf_iterator<char>());
+    file.close();
+
+    size_t builtinCount;
+    const VersionInterval* builtin = VersionManager::BuiltinIntervals(builtinCount);
+    int setCount = 0;
+    bool ok = CheckImageLayout(image, builtin, builtinCount, setCount);
+
+    if (ok && !SignatureDB::Load(kImagePath))
+        ok = Fail("the compiled image does not load");
+    if (ok)
+    {
+        ok = CheckRecords(setCount);
+        SignatureDB::Unload();
+    }
+
+    std::filesystem::remove(kImagePath, error);
+    return ok;
+}
+
+} // namespace Tests
@@ -0,0 +1,130 @@
+/*
+ * Rift - String Utility Tests
+ *
+ * BytesEqual and WideEquals (string_utils.cpp) at lengths around the
+ * 16-byte compare: none, tail only, exactly one and two blocks, and blocks
+ * plus a tail. Each length is checked equal and with one byte changed in
+ * the first block and in the last byte. The ranges end right before a
+ * PAGE_NOACCESS page, so a read past either of them faults.
+ */
+
+#include "tests.h"
+#include "string_utils.h"
+#include <cstring>
+#include <string>
+
+namespace Tests {
+
+static constexpr size_t kLengths[] = {0, 7, 8, 15, 16, 17, 33};
+static constexpr size_t kPage = 4096;
+
+// Two buffers of one readable page each, both followed by PAGE_NOACCESS
+class FencedBuffers {
+public:
+    FencedBuffers()
+        : m_base(static_cast<unsigned char*>(VirtualAlloc(nullptr, 4 * kPage,
+                                                          MEM_COMMIT | MEM_RESERVE,
+                                                          PAGE_READWRITE)))
+    {
+        DWORD old;
+        if (m_base && (!VirtualProtect(m_base + kPage, kPage, PAGE_NOACCESS, &old) ||
+                       !VirtualProtect(m_base + 3 * kPage, kPage, PAGE_NOACCESS, &old)))
+        {
+            VirtualFree(m_base, 0, MEM_RELEASE);
+            m_base = nullptr;
+        }
+    }
+
+    ~FencedBuffers()
+    {
+        if (m_base)
+            VirtualFree(m_base, 0, MEM_RELEASE);
+    }
+
+    FencedBuffers(const FencedBuffers&) = delete;
+    FencedBuffers& operator=(const FencedBuffers&) = delete;
+
+    explicit operator bool() const { return m_base != nullptr; }
+
+    // `size` bytes ending at the fence of buffer 0 or 1
+    unsigned char* End(int buffer, size_t size) const
+    {
+        return m_base + (2 * buffer + 1) * kPage - size;
+    }
+
+private:
+    unsigned char* m_base;
+};
+
+static bool CheckBytes(const FencedBuffers& buffers, size_t size)
+{
+    unsigned char* a = buffers.End(0, size);
+    unsigned char* b = buffers.End(1, size);
+    for (size_t i = 0; i < size; ++i)
+        a[i] = b[i] = static_cast<unsigned char>('A' + i % 26);
+
+    if (!StringUtils::BytesEqual(a, b, size))
+        return Fail("BytesEqual: equal ranges of %zu bytes compare unequal", size);
+
+    // Byte 0 is in the first 16-byte block once size >= 16; the last byte
+    // is in the tail unless size is a multiple of 16
+    const size_t changed[] = {0, size / 2, size - 1};
+    for (size_t position : changed)
+    {
+        if (!size)
+            break;
+        b[position] ^= 0x20;
+        bool equal = StringUtils::BytesEqual(a, b, size);
+        b[position] ^= 0x20;
+        if (equal)
+            return Fail("BytesEqual: %zu bytes differing at %zu compare equal", size, position);
+    }
+    return true;
+}
+
+static bool CheckWide(const FencedBuffers& buffers, size_t length)
+{
+    std::wstring target;
+    for (size_t i = 0; i < length; ++i)
+        target += static_cast<wchar_t>(L'a' + i % 26);
+
+    // The engine's buffer, ending at the fence
+    auto* name = reinterpret_cast<wchar_t*>(buffers.End(0, length * sizeof(wchar_t)));
+    std::memcpy(name, target.data(), length * sizeof(wchar_t));
+
+    if (!StringUtils::WideEquals(name, length, target))
+        return Fail("WideEquals: equal names of %zu characters compare unequal", length);
+    if (length && StringUtils::WideEquals(name, length - 1, target))
+        return Fail("WideEquals: a %zu-character prefix equals the whole name", length - 1);
+
+    const size_t changed[] = {0, length - 1};
+    for (size_t position : changed)
+    {
+        if (!length)
+            break;
+        name[position] = L'#';
+        bool equal = StringUtils::WideEquals(name, length, target);
+        name[position] = target[position];
+        if (equal)
+            return Fail("WideEquals: %zu characters differing at %zu compare equal",
+                        length, position);
+    }
+    return true;
+}
+
+bool StringCompare()
+{
+    FencedBuffers buffers;
+    if (!buffers)
+        return Fail("string compare: could not set up the fenced buffers");
+
+    bool ok = true;
+    for (size_t length : kLengths)
+    {
+        ok = CheckBytes(buffers, length) && ok;
+        ok = CheckWide(buffers, length) && ok;
+    }
+    return ok;
+}
+
+} // namespace Tests
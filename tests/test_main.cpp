@@ -0,0 +1,116 @@
+/*
+ * Rift - Test Runner
+ *
+ * Runs every test and exits non-zero if any of them failed. With --bench
+ * the benchmarks run afterwards (only when every test passed, so timings
+ * are never reported for wrong results).
+ *
+ * Usage: rift_tests [--bench]
+ */
+
+#include "tests.h"
+#include "ue4_sdk.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+// MSVC CRT instruction-set level, as in dllmain.cpp
+extern "C" int __isa_available;
+
+namespace Tests {
+
+bool Fail(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    fputs("FAIL ", stderr);
+    vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    va_end(args);
+    return false;
+}
+
+void Report(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    putchar('\n');
+    va_end(args);
+}
+
+double Elapsed(const LARGE_INTEGER& start)
+{
+    LARGE_INTEGER now, frequency;
+    QueryPerformanceCounter(&now);
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<double>(now.QuadPart - start.QuadPart) /
+           static_cast<double>(frequency.QuadPart);
+}
+
+} // namespace Tests
+
+struct TestCase {
+    const char* name;
+    bool (*run)();
+};
+
+struct BenchCase {
+    const char* name;
+    void (*run)();
+};
+
+static const TestCase g_Tests[] = {
+    {"decrypt.tiers", Tests::DecryptTiers},
+    {"decrypt.blobs", Tests::DecryptBlobs},
+    {"signatures.source", Tests::SignatureSource},
+    {"strings.compare", Tests::StringCompare},
+    {"safememory.regions", Tests::SafeMemoryRegions},
+    {"gobjects.flat", Tests::GObjectsFlat},
+    {"gobjects.chunked", Tests::GObjectsChunked},
+    {"gobjects.chain", Tests::GObjectsChain},
+    {"gobjects.batch", Tests::GObjectsBatch},
+    {"gobjects.recheck", Tests::GObjectsRecheck},
+    {"gobjects.sweep", Tests::GObjectsSweep},
+};
+
+static const BenchCase g_Benches[] = {
+    {"decrypt", Tests::BenchDecrypt},
+    {"gobjects", Tests::BenchGObjects},
+};
+
+int main(int argc, char** argv)
+{
+    bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+
+    // Select the decryption tier the way StartAddress does
+    Globals::dword_18004F028 = __isa_available;
+
+    // Misses are reported through Fail; a MessageBoxA would wait for a click
+    UE4::SetLookupBoxes(false);
+
+    int failed = 0;
+    for (const TestCase& test : g_Tests)
+    {
+        bool ok = test.run();
+        printf("%s %s\n", ok ? "ok  " : "FAIL", test.name);
+        failed += ok ? 0 : 1;
+    }
+
+    if (failed)
+    {
+        printf("%d of %d tests failed\n", failed,
+               static_cast<int>(sizeof(g_Tests) / sizeof(g_Tests[0])));
+        return 1;
+    }
+
+    if (bench)
+    {
+        for (const BenchCase& b : g_Benches)
+        {
+            printf("-- %s\n", b.name);
+            b.run();
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "globals.h"
+
+// Rift test and benchmark target (tests.vcxproj).
+//
+// Links every DLL source next to the test files, so the code under test is
+// exactly what ships. Tests return false on failure after reporting it
+// through Fail; benchmarks print one line per measurement through Report.
+namespace Tests {
+    // Print "FAIL <message>" to stderr; always returns false
+    bool Fail(const char* format, ...);
+
+    // Print one benchmark line to stdout
+    void Report(const char* format, ...);
+
+    // Seconds since `start` on the performance counter
+    double Elapsed(const LARGE_INTEGER& start);
+
+    // decrypt_tests.cpp
+    bool DecryptTiers();
+    bool DecryptBlobs();
+    void BenchDecrypt();
+
+    // signature_db_tests.cpp
+    bool SignatureSource();
+
+    // string_utils_tests.cpp
+    bool StringCompare();
+
+    // safe_memory_tests.cpp
+    bool SafeMemoryRegions();
+
+    // gobjects_tests.cpp
+    bool GObjectsFlat();
+    bool GObjectsChunked();
+    bool GObjectsChain();
+    bool GObjectsBatch();
+    bool GObjectsRecheck();
+    bool GObjectsSweep();
+    void BenchGObjects();
+}
@@ -0,0 +1,30 @@
+/*
+ * sigdbc - Rift signature database compiler
+ *
+ * Compiles the JSON signature source (data/signatures.json) into the binary
+ * image the DLL maps at startup. Place the output next to Rift.dll as
+ * signatures.rsdb.
+ *
+ * Usage: sigdbc <input.json> <output.rsdb>
+ */
+
+#include "signature_db.h"
+#include <cstdio>
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: sigdbc <input.json> <output.rsdb>\n");
+        return 2;
+    }
+
+    std::string error;
+    if (!SignatureDB::CompileSource(argv[1], argv[2], error))
+    {
+        fprintf(stderr, "sigdbc: %s\n", error.c_str());
+        return 1;
+    }
+
+    return 0;
+}